@@ -33,6 +33,7 @@
 #include "gui/map.hpp"
 #include "gui/routines.hpp"
 #include "gui/screen.hpp"
+#include "gui/stats.hpp"
 #include "motion/kinematics.hpp"
 #include "motion/motionProfile.hpp"
 #include "motion/moveTo.hpp"
@@ -41,17 +42,30 @@
 #include "motion/pathFollower.hpp"
 #include "motion/profileFollower.hpp"
 #include "motion/turn.hpp"
+#include "pose/derivativeEstimator.hpp"
+#include "pose/ekf.hpp"
 #include "pose/odometry.hpp"
+#include "pose/particleFilter.hpp"
 #include "pose/tracker.hpp"
 #include "systems/drive.hpp"
 #include "systems/remote.hpp"
 #include "systems/robot.hpp"
 #include "systems/stateMachine.hpp"
+#include "time/conditions.hpp"
+#include "time/coroutine.hpp"
+#include "time/executor.hpp"
+#include "time/rate.hpp"
 #include "time/scheduler.hpp"
+#include "time/signal.hpp"
 #include "time/task.hpp"
+#include "time/taskStats.hpp"
 #include "time/time.hpp"
 #include "time/timer.hpp"
 #include "utility/acceptable.hpp"
 #include "utility/logger.hpp"
+#include "utility/metrics.hpp"
 #include "utility/misc.hpp"
+#include "utility/ringBuffer.hpp"
+#include "utility/snapshot.hpp"
+#include "utility/telemetry.hpp"
 #include "utility/units.hpp"
@@ -10,11 +10,15 @@
 #pragma once
 
 #include "../utility/logger.hpp"
+#include "../utility/telemetry.hpp"
 
 namespace atum {
 /**
  * @brief Acts as an interface for control algorithms like PID and TBH.
  *
+ * Every output is recorded to telemetry along with the error it was calculated
+ * from, under a number identifying the controller in order of construction.
+ *
  */
 class Controller {
   public:
@@ -27,7 +31,8 @@ class Controller {
 
   /**
    * @brief Gets the last calculated output. 
-   * For in-class use, standardizes the debug logger output. 
+   * For in-class use, standardizes the debug logger output and records the
+   * output and last error to telemetry.
    *
    * @return double
    */
@@ -59,5 +64,12 @@ class Controller {
   protected:
   Logger logger;
   double output;
+  double lastError{0.0}; // Set with each output for telemetry.
+
+  private:
+  std::uint16_t id;
+
+  static std::uint16_t constructed;
+  static const Telemetry::Channel telemetryChannel;
 };
 } // namespace atum
\ No newline at end of file
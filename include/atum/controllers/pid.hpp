@@ -33,7 +33,7 @@ class PID : public Controller {
     double kD{0};
     double ff{0};
     // Threshold of error at which the integral term begins accumulating.
-    double threshI{std::numeric_limits<long double>::max()};
+    double threshI{std::numeric_limits<double>::max()};
     // If ffScaling is true, then feedforward will be scaled by the desired
     // reference. Otherwise, the raw value will simply be added to the total
     // output.
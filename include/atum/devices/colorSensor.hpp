@@ -10,9 +10,12 @@
 #pragma once
 
 #include "../../pros/optical.hpp"
+#include "../time/executor.hpp"
+#include "../time/signal.hpp"
 #include "../time/time.hpp"
 #include "../utility/logger.hpp"
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace atum {
@@ -77,6 +80,12 @@ class ColorSensor {
   ColorSensor(const std::vector<HueField> iHueFields,
               const Logger::Level loggerLevel = Logger::Level::Info);
 
+  /**
+   * @brief Stops sampling the color sensor, if it was.
+   *
+   */
+  ~ColorSensor();
+
   /**
    * @brief Gets the detected color. Will return None if outside of proximity
    * threshold given (unless 0). Turns LED on if something is nearby.
@@ -124,6 +133,15 @@ class ColorSensor {
    */
   bool check();
 
+  /**
+   * @brief Gets the signal raised whenever the detected color changes. The
+   * first call starts sampling the sensor every refresh in the background, so
+   * conditions on the color don't have to poll it themselves.
+   *
+   * @return const Signal&
+   */
+  const Signal &getChangeSignal();
+
   private:
   /**
    * @brief This is the value get_proximity returns when an object is considered
@@ -138,11 +156,23 @@ class ColorSensor {
    */
   void initializeColorSensor();
 
+  /**
+   * @brief Gets the detected color without counting objects passing by.
+   *
+   * @return Color
+   */
+  Color detectColor();
+
   std::unique_ptr<pros::v5::Optical> colorSensor;
   std::vector<HueField> hueFields;
   Logger logger;
   int count{0};
   bool previousNearby{false};
+  Signal changeSignal;
+  // Taken so tasks asking for the signal at once don't each start a sampler.
+  pros::Mutex samplerMutex;
+  std::optional<Executor::Handle> sampler;
+  Color sampledColor{Color::None};
 };
 
 /**
@@ -12,6 +12,7 @@
 #include "../pose/gps.hpp"
 #include "../time/time.hpp"
 #include "../utility/logger.hpp"
+#include "../utility/telemetry.hpp"
 #include "../utility/units.hpp"
 #include "pros/apix.h"
 
@@ -85,5 +86,7 @@ class IMU {
   const bool reversed;
   Logger logger;
   degree_t previous{0_deg};
+
+  static const Telemetry::Channel telemetryChannel;
 };
 } // namespace atum
\ No newline at end of file
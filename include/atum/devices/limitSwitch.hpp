@@ -9,8 +9,11 @@
 
 #pragma once
 
+#include "../time/executor.hpp"
+#include "../time/signal.hpp"
 #include "../utility/logger.hpp"
 #include "adi.hpp"
+#include <optional>
 
 namespace atum {
 /**
@@ -39,6 +42,12 @@ class LimitSwitch {
   LimitSwitch(const ADIExtenderPort &port,
               const Logger::Level loggerLevel = Logger::Level::Info);
 
+  /**
+   * @brief Stops sampling the limit switch, if it was.
+   *
+   */
+  ~LimitSwitch();
+
   /**
    * @brief Returns if the limit switch is pressed.
    *
@@ -55,8 +64,22 @@ class LimitSwitch {
    */
   bool isNewlyPressed();
 
+  /**
+   * @brief Gets the signal raised whenever the limit switch is pressed or
+   * released. The first call starts sampling the switch every standard delay
+   * in the background, so conditions on it don't have to poll it themselves.
+   *
+   * @return const Signal&
+   */
+  const Signal &getChangeSignal();
+
   private:
   pros::adi::DigitalIn limitSwitch;
   Logger logger;
+  Signal changeSignal;
+  // Taken so tasks asking for the signal at once don't each start a sampler.
+  pros::Mutex samplerMutex;
+  std::optional<Executor::Handle> sampler;
+  bool sampledPressed{false};
 };
 } // namespace atum
\ No newline at end of file
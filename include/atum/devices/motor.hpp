@@ -11,6 +11,8 @@
 
 #include "../../pros/motor_group.hpp"
 #include "../utility/logger.hpp"
+#include "../utility/metrics.hpp"
+#include "../utility/telemetry.hpp"
 #include "../utility/units.hpp"
 
 namespace atum {
@@ -205,14 +207,28 @@ class Motor {
    */
   std::string getName(const std::int8_t port);
 
+  /**
+   * @brief Records the raw position and velocity of one of the motors to
+   * telemetry with double precision, so they can be replayed exactly.
+   *
+   * @param i
+   */
+  void recordReadings(const std::size_t i) const;
+
   const Gearing gearing;
   const std::string name;
   Logger logger;
   std::vector<std::unique_ptr<pros::v5::Motor>> motors;
   std::vector<char> enabled; // Avoid vector<bool>.
+  std::vector<char> overheated;
   // Involved in an easy fix for a bug with is_installed until the PROS team
   // fixes it.
   std::vector<int> directions;
   degree_t offset{0_deg};
+
+  static const Telemetry::Channel telemetryChannel;
+  static const Telemetry::Channel readingsChannel;
+  static Metrics::Counter disconnects;
+  static Metrics::Counter overheats;
 };
 } // namespace atum
\ No newline at end of file
@@ -11,6 +11,7 @@
 
 #include "../time/time.hpp"
 #include "../utility/logger.hpp"
+#include "../utility/telemetry.hpp"
 #include "../utility/units.hpp"
 
 namespace atum {
@@ -86,5 +87,7 @@ class Odometer {
   const inch_t fromCenter;
   int32_t prevTicks{0};
   Logger logger;
+
+  static const Telemetry::Channel telemetryChannel;
 };
 } // namespace atum
\ No newline at end of file
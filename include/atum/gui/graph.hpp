@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../../pros/misc.hpp"
+#include "../utility/ringBuffer.hpp"
 #include "screen.hpp"
 #include <algorithm>
 #include <array>
@@ -21,6 +22,14 @@ namespace GUI {
  * screen of the GUI. This is helpful for tuning motion profiles, controllers,
  * and general troubleshooting.
  *
+ * Values and clears are queued without blocking, so control loops never touch
+ * LVGL. Once per display refresh, the queue is drained onto the chart and the
+ * chart is redrawn once. Every samplesPerBucket values of a series are drawn
+ * as just their minimum and maximum, in the order they came, so the chart
+ * covers twice as long while keeping any spikes. A series that gets no new
+ * values in a refresh has what it has so far drawn, so slow series don't lag
+ * and the end of a plot is drawn once the robot is disabled.
+ *
  */
 class Graph : public Screen {
   public:
@@ -39,9 +48,9 @@ class Graph : public Screen {
   };
 
   /**
-   * @brief Adds a data point on one of the graph series. Won't add the point if
-   * the robot is disabled (in order to provide the option to "freeze" data
-   * input).
+   * @brief Queues a data point on one of the graph series. Won't add the point
+   * if the robot is disabled (in order to provide the option to "freeze" data
+   * input). Dropped if the queue is full.
    *
    * @param value
    * @param seriesColor
@@ -67,18 +76,27 @@ class Graph : public Screen {
   static void setSeriesRange(double range, const SeriesColor seriesColor);
 
   /**
-   * @brief Clears all the data points in a given series.
+   * @brief Queues clearing all the data points in a given series.
    *
    * @param seriesColor
    */
   static void clearSeries(const SeriesColor seriesColor);
 
   /**
-   * @brief Clears all the data points in every series.
+   * @brief Queues clearing all the data points in every series.
    *
    */
   static void clearAll();
 
+  /**
+   * @brief Draws everything queued onto the chart. Ran every display refresh
+   * period.
+   *
+   */
+  static void render();
+
+  static constexpr std::size_t samplesPerBucket{4};
+
   private:
   /**
    * @brief This deals with setting up the actual screen. Private to force
@@ -87,10 +105,42 @@ class Graph : public Screen {
    */
   static void setupScreen();
 
+  /**
+   * @brief Draws the values of the series not yet drawn, as their minimum and
+   * maximum in the order they came, and empties its bucket.
+   *
+   * @param series
+   */
+  static void flush(const std::size_t series);
+
+  /**
+   * @brief A value to add to a series, or a request to clear it.
+   *
+   */
+  struct Command {
+    std::uint8_t series;
+    bool clear;
+    lv_coord_t value;
+  };
+
+  /**
+   * @brief The values of a series not yet drawn.
+   *
+   */
+  struct Bucket {
+    std::size_t count{0};
+    lv_coord_t minimum{0};
+    lv_coord_t maximum{0};
+    std::size_t minimumAt{0};
+    std::size_t maximumAt{0};
+  };
+
   static const int graphResolution;
   static lv_obj_t *graphChart;
   static std::array<lv_chart_series_t *, 7> graphSeries;
   static std::array<SeriesRange, 7> graphSeriesRanges;
+  static RingBuffer<Command, 512> pending;
+  static std::array<Bucket, 7> buckets;
 };
 } // namespace GUI
 } // namespace atum
\ No newline at end of file
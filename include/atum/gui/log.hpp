@@ -9,7 +9,10 @@
 
 #pragma once
 
+#include "../../pros/rtos.hpp"
 #include "screen.hpp"
+#include <array>
+#include <string_view>
 
 namespace atum {
 namespace GUI {
@@ -18,6 +21,12 @@ namespace GUI {
  * screen of the GUI. The logger acts as the "controller" for logging,
  * while this class deals with displaying information to the screen.
  *
+ * Lines are kept in a fixed circular array of slots, each shown by its own
+ * label. Writing only copies the line into its slot, and the labels are
+ * updated at most once per display refresh, so a burst of messages costs one
+ * redraw and the label holding the oldest line is the only one rewritten for
+ * each new line.
+ *
  */
 class Log : public Screen {
   public:
@@ -27,11 +36,23 @@ class Log : public Screen {
 
   /**
    * @brief Writes a message to the screen. Should generally use the Logger
-   * class instead of this, but is included for situational purposes.
+   * class instead of this, but is included for situational purposes. A
+   * trailing newline is dropped, and anything past maxLineLength is cut off.
+   * The message appears on the next refresh.
    *
    * @param msg
    */
-  static void write(const std::string &msg);
+  static void write(std::string_view msg);
+
+  /**
+   * @brief Updates the labels of every line written since the last refresh.
+   * Ran every display refresh period while the log screen is shown.
+   *
+   */
+  static void refresh();
+
+  static constexpr std::size_t maxLogLines{100};
+  static constexpr std::size_t maxLineLength{128};
 
   private:
   /**
@@ -41,10 +62,12 @@ class Log : public Screen {
    */
   static void setupScreen();
 
-  static const std::size_t maxLogLines;
-  static lv_obj_t *logTextLabel;
-  static std::string logText;
-  static std::size_t logLines;
+  static lv_obj_t *logTextBackground;
+  static std::array<std::array<char, maxLineLength>, maxLogLines> lines;
+  static std::array<lv_obj_t *, maxLogLines> lineLabels;
+  static std::size_t written; // Lines written in total.
+  static std::size_t shown;   // Lines written in total as of the last refresh.
+  static pros::Mutex linesMutex;
 };
 } // namespace GUI
-} // namespace atum
\ No newline at end of file
+} // namespace atum
@@ -14,6 +14,7 @@
 #include "map.hpp"
 #include "routines.hpp"
 #include "screen.hpp"
+#include "stats.hpp"
 
 namespace atum {
 namespace GUI {
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../pose/pose.hpp"
+#include "../utility/ringBuffer.hpp"
 #include "screen.hpp"
 #include <array>
 
@@ -20,6 +21,11 @@ namespace GUI {
  * screen of the GUI. This is useful for visualizing pathing and tracking
  * systems.
  *
+ * Like the graph, points and clears are queued without blocking and drawn
+ * once per display refresh. A point landing on the same pixel as the last one
+ * drawn in its series is skipped, so a robot sitting still doesn't push its
+ * trail off the map.
+ *
  */
 class Map : public Screen {
   public:
@@ -28,7 +34,7 @@ class Map : public Screen {
   friend class Manager;
 
   /**
-   * @brief Add several points to a series on the map at once.
+   * @brief Queues several points to a series on the map at once.
    *
    * @param positions
    * @param seriesColor
@@ -37,7 +43,8 @@ class Map : public Screen {
                            const SeriesColor seriesColor);
 
   /**
-   * @brief Add a point to a series on the map.
+   * @brief Queues a point to a series on the map. Dropped if the queue is
+   * full.
    *
    * @param position
    * @param seriesColor
@@ -45,12 +52,19 @@ class Map : public Screen {
   static void addPosition(const Pose position, const SeriesColor seriesColor);
 
   /**
-   * @brief Clear all points in a series.
+   * @brief Queues clearing all points in a series.
    *
    * @param seriesColor
    */
   static void clearSeries(const SeriesColor seriesColor);
 
+  /**
+   * @brief Draws everything queued onto the map. Ran every display refresh
+   * period.
+   *
+   */
+  static void render();
+
   private:
   /**
    * @brief This deals with setting up the actual screen. Private to force the
@@ -59,9 +73,33 @@ class Map : public Screen {
    */
   static void setupScreen();
 
+  /**
+   * @brief A point to add to a series, or a request to clear it.
+   *
+   */
+  struct Command {
+    std::uint8_t series;
+    bool clear;
+    lv_coord_t x;
+    lv_coord_t y;
+  };
+
+  /**
+   * @brief The pixel of the last point drawn in a series, if any.
+   *
+   */
+  struct Pixel {
+    bool drawn{false};
+    int x{0};
+    int y{0};
+  };
+
   static const int mapResolution;
+  static const int mapChartSize;
   static lv_obj_t *mapChart;
   static std::array<lv_chart_series_t *, 7> mapSeries;
+  static RingBuffer<Command, 512> pending;
+  static std::array<Pixel, 7> lastPixels;
 };
 } // namespace GUI
 } // namespace atum
\ No newline at end of file
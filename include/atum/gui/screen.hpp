@@ -162,6 +162,7 @@ class Screen {
   static lv_obj_t *homeScreen;
   static lv_obj_t *routinesScreen;
   static lv_obj_t *logScreen;
+  static lv_obj_t *statsScreen;
   static lv_obj_t *graphScreen;
   static lv_obj_t *mapScreen;
 };
@@ -0,0 +1,46 @@
+/**
+ * @file stats.hpp
+ * @brief Includes the Stats class.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "screen.hpp"
+
+namespace atum {
+namespace GUI {
+/**
+ * @brief This class encapsulates the logic and construction of the stats
+ * screen of the GUI, which lists a snapshot of every metric (see
+ * atum::Metrics). The snapshot is refreshed periodically, but only while the
+ * screen is being shown.
+ *
+ */
+class Stats : public Screen {
+  public:
+  // Friend Manager to give access to screen set up. Not ideal, but
+  // straightforward solution.
+  friend class Manager;
+
+  /**
+   * @brief Rewrites the screen with a new snapshot of every metric.
+   *
+   */
+  static void refresh();
+
+  private:
+  /**
+   * @brief This deals with setting up the actual screen and starting its
+   * periodic refresh. Private to force the proper series of steps for setup.
+   *
+   */
+  static void setupScreen();
+
+  static lv_obj_t *statsTextLabel;
+};
+} // namespace GUI
+} // namespace atum
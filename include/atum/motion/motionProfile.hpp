@@ -139,7 +139,7 @@ class MotionProfile {
       defaultParams{iDefaultParams},
       params{iDefaultParams},
       logger{loggerLevel} {
-    logger.debug("Motion profile has been constructed!");
+    LOG_DEBUG(logger, "Motion profile has been constructed!");
   }
 
   /**
@@ -168,7 +168,7 @@ class MotionProfile {
     beginProfile();
     finishProfile();
     timer.restart();
-    logger.debug("Motion profile going from " + to_string(start) + " to " +
+    LOG_DEBUG(logger, "Motion profile going from " + to_string(start) + " to " +
                  to_string(end) + " has been generated!");
   }
 
@@ -396,7 +396,7 @@ class MotionProfile {
    *
    */
   void profile4Stage() {
-    logger.debug("Generated profile is 4 stages.");
+    LOG_DEBUG(logger, "Generated profile is 4 stages.");
     const Unit absTarget{abs(target)};
     points[0].t = points[2].t = points[4].t = points[6].t =
         second_t{cbrt(getValueAs<Unit>(absTarget) /
@@ -415,7 +415,7 @@ class MotionProfile {
    *
    */
   void profile5Stage() {
-    logger.debug("Generated profile is 5 stages.");
+    LOG_DEBUG(logger, "Generated profile is 5 stages.");
     const Unit absTarget{abs(target)};
     points[0].t = points[2].t = points[4].t = points[6].t =
         sqrt(params.maxV / params.maxJ);
@@ -434,7 +434,7 @@ class MotionProfile {
    *
    */
   void profile6Stage() {
-    logger.debug("Generated profile is 6 stages.");
+    LOG_DEBUG(logger, "Generated profile is 6 stages.");
     const Unit absTarget{abs(target)};
     const UnitsPerSecond b{3.0 * params.maxA * params.maxA / params.maxJ};
     const Unit c{2.0 * params.maxA * params.maxA * params.maxA / params.maxJ /
@@ -466,7 +466,7 @@ class MotionProfile {
    *
    */
   void profileAllStages() {
-    logger.debug("Generated profile is 7 (all) stages.");
+    LOG_DEBUG(logger, "Generated profile is 7 (all) stages.");
     const Unit absTarget{abs(target)};
     points[0].t = points[2].t = points[4].t = points[6].t =
         params.maxA / params.maxJ;
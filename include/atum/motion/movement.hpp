@@ -9,6 +9,11 @@
 
 #pragma once
 
+#include "../time/rate.hpp"
+#include "../time/coroutine.hpp"
+#include <atomic>
+#include <memory>
+
 namespace atum {
 /**
  * @brief Provides common functionality between drive movements.
@@ -17,12 +22,24 @@ namespace atum {
 class Movement {
   public:
   /**
-   * @brief Interrupts the current movement. Up to children to reset the
-   * interrupted variable.
+   * @brief Interrupts the motion that is running, if any. Motions started
+   * afterward are unaffected.
    *
    */
   void interrupt();
 
+  /**
+   * @brief Makes a routine that runs the given motion on its own task,
+   * interrupting it if the routine is cancelled first. This lets motions
+   * overlap with other actions through whenAll, whenAny, and withTimeout.
+   * Cancelling the routine only ever stops the motion it started, and if it is
+   * cancelled before the motion starts, the motion never does.
+   *
+   * @param motion
+   * @return Coroutine
+   */
+  Coroutine async(const std::function<void()> motion);
+
   /**
    * @brief Sets whether the movement targets should be flipped across the
    * x-axis (if the color is changed).
@@ -31,8 +48,63 @@ class Movement {
    */
   static void setFlipped(const bool iFlipped);
 
+  /**
+   * @brief Gets the rate the movement's control loop runs at, which can be
+   * checked for the frequency it actually achieved.
+   *
+   * @return const Rate&
+   */
+  const Rate &getRate() const;
+
   protected:
+  /**
+   * @brief Claims the movement for a motion on the calling task, waiting for
+   * any other task's motion to finish first. Each motion has its own cancel
+   * token, so interrupting one never carries over to the next. A motion
+   * started from within another on the same task, such as each command of a
+   * path, shares the outer motion's token.
+   *
+   * @return true The motion can run.
+   * @return false The motion was cancelled before it started, so should not
+   * run. finish should not be called.
+   */
+  bool start();
+
+  /**
+   * @brief Says if the running motion has been interrupted. Only to be called
+   * by the task running it.
+   *
+   * @return true
+   * @return false
+   */
+  bool isInterrupted() const;
+
+  /**
+   * @brief Releases the claim made by start, once the motion has stopped.
+   *
+   * @return true The motion was interrupted.
+   * @return false
+   */
+  bool finish();
+
   static bool flipped;
-  bool interrupted{false};
+  // Reset at the start of each control loop.
+  Rate rate{};
+
+  private:
+  /**
+   * @brief Claims the movement with the given cancel token, as start does.
+   *
+   * @param iToken
+   * @return true
+   * @return false
+   */
+  bool claim(const std::shared_ptr<std::atomic<bool>> &iToken);
+
+  pros::Mutex claimMutex;
+  // The task running a motion, and how many motions deep it is.
+  pros::task_t owner{nullptr};
+  std::size_t depth{0};
+  std::shared_ptr<std::atomic<bool>> token;
 };
 } // namespace atum
\ No newline at end of file
@@ -11,6 +11,7 @@
 
 #include "../controllers/controller.hpp"
 #include "../utility/acceptable.hpp"
+#include "../utility/telemetry.hpp"
 #include "motionProfile.hpp"
 
 namespace atum {
@@ -33,6 +34,9 @@ struct AccelerationConstants {
  * the velocity controller, moving onto acceleration constants, before adding in
  * velocity and position feedback.
  *
+ * Each output is recorded to telemetry along with the readings and reference
+ * it was calculated from, in Unit and its derivatives.
+ *
  * @tparam Unit
  */
 template <typename Unit>
@@ -84,7 +88,7 @@ class ProfileFollower {
     if(!velocityController) {
       logger.error("Must provide a velocity controller to profile follower!");
     }
-    logger.debug("Profile follower constructed!");
+    LOG_DEBUG(logger, "Profile follower constructed!");
   }
 
   /**
@@ -107,8 +111,9 @@ class ProfileFollower {
     if(positionController) {
       positionController->reset();
     }
-    logger.debug("Profile follower to follow profile from " + to_string(start) +
-                 " to " + to_string(end) + ".");
+    LOG_DEBUG(logger,
+              "Profile follower to follow profile from " + to_string(start) +
+              " to " + to_string(end) + ".");
     if(logger.getLevel() == Logger::Level::Debug) {
       prepareGraphing(start);
     }
@@ -133,7 +138,15 @@ class ProfileFollower {
                                       getValueAs<UnitsPerSecond>(reference.v))};
     double accelerationOutput{getAccelerationOutput(reference.a)};
     acceptable.canAccept(s, end);
-    return positionOutput + velocityOutput + accelerationOutput;
+    const double output{positionOutput + velocityOutput + accelerationOutput};
+    Telemetry::record(telemetryChannel,
+                      getValueAs<Unit>(s),
+                      getValueAs<UnitsPerSecond>(v),
+                      getValueAs<Unit>(reference.s),
+                      getValueAs<UnitsPerSecond>(reference.v),
+                      getValueAs<UnitsPerSecondSq>(reference.a),
+                      output);
+    return output;
   }
 
   /**
@@ -219,6 +232,15 @@ class ProfileFollower {
   const double timeoutScaling;
   Logger logger;
   Unit end;
+
+  static inline const Telemetry::Channel telemetryChannel{
+      Telemetry::addChannel("profile " + std::string{units::abbreviation(Unit{})},
+                            {"s",
+                             "v",
+                             "reference_s",
+                             "reference_v",
+                             "reference_a",
+                             "output"})};
 };
 
 /**
@@ -0,0 +1,207 @@
+/**
+ * @file derivativeEstimator.hpp
+ * @brief Includes the DerivativeEstimator parent class and its derivatives.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../utility/units.hpp"
+#include <algorithm>
+#include <array>
+#include <memory>
+
+namespace atum {
+/**
+ * @brief Acts as an interface for estimating how fast a measured value is
+ * changing, and how fast that is changing, from how much it changed between
+ * updates. Odometry uses one for the distance driven forward and one for the
+ * heading, to fill in velocities and accelerations.
+ *
+ * Differencing the latest change alone responds immediately, but amplifies the
+ * noise in each reading by how short the update is. The estimators here trade
+ * some of that responsiveness for less noise, and never allocate after
+ * construction.
+ *
+ */
+class DerivativeEstimator {
+  public:
+  /**
+   * @brief A rate and acceleration, in the units of the value per second and
+   * per second squared.
+   *
+   */
+  struct Estimate {
+    double rate{0.0};
+    double acceleration{0.0};
+  };
+
+  virtual ~DerivativeEstimator() = default;
+
+  /**
+   * @brief Takes how much the value changed over the time since the last
+   * update, and returns the new estimate. Updates that take no time are
+   * ignored.
+   *
+   * @param change
+   * @param dt
+   * @return Estimate
+   */
+  virtual Estimate update(const double change, const second_t dt) = 0;
+
+  /**
+   * @brief Forgets every change seen so far, starting again from rest.
+   *
+   */
+  virtual void reset() = 0;
+
+  /**
+   * @brief Makes a new estimator with the same settings, starting from rest.
+   *
+   * @return std::unique_ptr<DerivativeEstimator>
+   */
+  virtual std::unique_ptr<DerivativeEstimator> clone() const = 0;
+};
+
+/**
+ * @brief Takes the rate as the latest change over the time it took, and the
+ * acceleration as the change in that rate. Has no lag, but the most noise.
+ *
+ */
+class FiniteDifference : public DerivativeEstimator {
+  public:
+  Estimate update(const double change, const second_t dt) override;
+  void reset() override;
+  std::unique_ptr<DerivativeEstimator> clone() const override;
+
+  private:
+  Estimate estimate;
+};
+
+/**
+ * @brief Fits a quadratic to the last few values by least squares, as a
+ * Savitzky-Golay filter does, and takes the derivatives of the fit at the
+ * latest update. The fit uses the times each value was read at, so it stays
+ * correct when updates are late.
+ *
+ * A quadratic fit follows constant accelerations without lag. Longer windows
+ * average out more noise, but round off changes in acceleration that happen
+ * within them.
+ *
+ */
+class SavitzkyGolay : public DerivativeEstimator {
+  public:
+  /**
+   * @brief The most values a window can hold.
+   *
+   */
+  static constexpr std::size_t maxWindow{32};
+
+  /**
+   * @brief Constructs a new SavitzkyGolay fitting the given number of values,
+   * which is kept between 3 and maxWindow.
+   *
+   * @param iWindow
+   */
+  SavitzkyGolay(const std::size_t iWindow = 9);
+
+  Estimate update(const double change, const second_t dt) override;
+  void reset() override;
+  std::unique_ptr<DerivativeEstimator> clone() const override;
+
+  private:
+  /**
+   * @brief A value and the time it was read at, both since the estimator
+   * started.
+   *
+   */
+  struct Sample {
+    double time;
+    double value;
+  };
+
+  const std::size_t window;
+  std::array<Sample, maxWindow> samples;
+  std::size_t next{0};
+  std::size_t count{0};
+  Sample latest{0.0, 0.0};
+  Estimate estimate;
+};
+
+/**
+ * @brief Predicts the value from the last estimate, and corrects the value,
+ * rate, and acceleration by fixed fractions of how far off the prediction was.
+ * With a gamma of zero, this is an alpha-beta filter and the acceleration
+ * stays zero.
+ *
+ * Larger gains follow changes sooner, but let through more noise. Gains that
+ * work well together can be found from KalmanDerivative's noise, as it settles
+ * on fixed gains when updates are regular.
+ *
+ */
+class AlphaBetaGamma : public DerivativeEstimator {
+  public:
+  /**
+   * @brief Constructs a new AlphaBetaGamma with the given gains for the value,
+   * rate, and acceleration.
+   *
+   * @param iAlpha
+   * @param iBeta
+   * @param iGamma
+   */
+  AlphaBetaGamma(const double iAlpha = 0.7,
+                 const double iBeta = 0.3,
+                 const double iGamma = 0.03);
+
+  Estimate update(const double change, const second_t dt) override;
+  void reset() override;
+  std::unique_ptr<DerivativeEstimator> clone() const override;
+
+  private:
+  const double alpha;
+  const double beta;
+  const double gamma;
+  double measured{0.0};
+  double value{0.0};
+  Estimate estimate;
+};
+
+/**
+ * @brief A Kalman filter assuming the acceleration changes randomly, with the
+ * value read each update. Unlike AlphaBetaGamma, how much it trusts each
+ * reading follows from how long the update took.
+ *
+ */
+class KalmanDerivative : public DerivativeEstimator {
+  public:
+  /**
+   * @brief Constructs a new KalmanDerivative.
+   *
+   * @param iJerkNoise How much the acceleration is expected to change, as the
+   * spectral density of the jerk, in the units of the value squared per
+   * second to the fifth.
+   * @param iMeasurementNoise The standard deviation of each reading of the
+   * value, such as the distance one tick of an encoder covers over the square
+   * root of 12.
+   */
+  KalmanDerivative(const double iJerkNoise = 1e6,
+                   const double iMeasurementNoise = 0.0065);
+
+  Estimate update(const double change, const second_t dt) override;
+  void reset() override;
+  std::unique_ptr<DerivativeEstimator> clone() const override;
+
+  private:
+  using Covariance = std::array<std::array<double, 3>, 3>;
+
+  const double jerkNoise;
+  const double measurementNoise;
+  double measured{0.0};
+  // The value, rate, and acceleration, and how uncertain they are.
+  std::array<double, 3> state{};
+  Covariance covariance{};
+};
+} // namespace atum
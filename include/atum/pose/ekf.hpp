@@ -0,0 +1,168 @@
+/**
+ * @file ekf.hpp
+ * @brief Includes the EKF class.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../utility/metrics.hpp"
+#include "gps.hpp"
+#include "odometry.hpp"
+#include <array>
+#include <optional>
+
+namespace atum {
+/**
+ * @brief Performs tracking with an extended Kalman filter, fusing odometry
+ * with the GPS's position. Unlike resetting odometry with GPS::resetTracker,
+ * each GPS reading only moves the pose as far as its reported error warrants,
+ * so the pose doesn't jump for motions to chase.
+ *
+ * Every update, the displacement measured by Odometry is the process model,
+ * with noise growing with how far the robot moved and turned. As the turn is
+ * the IMU's, the IMU is only this control input. Fusing its heading again as a
+ * measurement would count it twice and make the filter too sure of the
+ * heading, so the heading is only corrected through the positions it leads
+ * to.
+ *
+ * Any new GPS position is then a measurement with the GPS's reported error as
+ * its standard deviation. If the GPS has latency, the reading is compared with
+ * the pose tracked when it was taken, and the difference applied now. GPS
+ * readings too far off to be believed given both uncertainties are rejected.
+ *
+ * The state is the pose in inches and radians, along with its covariance.
+ *
+ */
+class EKF : public Odometry {
+  public:
+  /**
+   * @brief The covariance of x, y, and h, in square inches, inch radians, and
+   * square radians.
+   *
+   */
+  using Covariance = std::array<std::array<double, 3>, 3>;
+
+  /**
+   * @brief The noise assumed in each source, as standard deviations.
+   *
+   */
+  struct Parameters {
+    double translationNoise{0.05}; // Per inch traveled.
+    double rotationNoise{0.02};    // Per radian turned.
+    inch_t initialPositionNoise{0.5_in};
+    degree_t initialHeadingNoise{0.5_deg};
+    // GPS readings further than this squared Mahalanobis distance from the
+    // pose are rejected. Rejects about 1 in 1000 good readings.
+    double gpsGate{13.8};
+  };
+
+  /**
+   * @brief Constructs a new EKF, taking the same sensors as Odometry along
+   * with a GPS. The GPS may be null, in which case the filter only tracks
+   * with odometry, though still with its covariance.
+   *
+   * The startBackgroundTasks() method will have to be called if you expect
+   * tracking to be performed in the background.
+   *
+   * @param iForward
+   * @param iSide
+   * @param iImu
+   * @param iDrive
+   * @param iGps
+   * @param iParams
+   * @param loggerLevel
+   */
+  EKF(std::unique_ptr<Odometer> iForward,
+      std::unique_ptr<Odometer> iSide,
+      std::unique_ptr<IMU> iImu,
+      Drive *iDrive,
+      GPS *iGps,
+      const Parameters &iParams,
+      const Logger::Level loggerLevel = Logger::Level::Info);
+
+  /**
+   * @brief Predicts the pose from odometry, then corrects it with the GPS.
+   *
+   * @return Pose
+   */
+  Pose update() override;
+
+  /**
+   * @brief Sets the current pose, resetting its covariance to the initial
+   * noise given in the parameters.
+   *
+   * @param iPose
+   */
+  void setPose(const Pose &iPose) override;
+
+  /**
+   * @brief Gets the covariance of the current pose.
+   *
+   * @return Covariance
+   */
+  Covariance getCovariance() const;
+
+  protected:
+  /**
+   * @brief Moves the state by the correction, and turns its covariance with
+   * it, rather than resetting the covariance as setPose does.
+   *
+   * @param correction
+   */
+  void correctState(const Correction &correction) override;
+
+  private:
+  /**
+   * @brief A new GPS position and its error, in inches.
+   *
+   */
+  struct PositionReading {
+    double x;
+    double y;
+    double error;
+    // Where the robot was tracked to be when the reading was taken, if the GPS
+    // has latency. Otherwise the reading is compared with the current state.
+    std::optional<Pose> then;
+  };
+
+  /**
+   * @brief Gets a new GPS reading, if there is one. Called before stepping
+   * the pose, as looking up the pose when it was taken takes the write lock
+   * too.
+   *
+   * @return std::optional<PositionReading>
+   */
+  std::optional<PositionReading> readGPS();
+
+  /**
+   * @brief Moves the state by the displacement and grows the covariance.
+   *
+   * @param displacement
+   */
+  void predict(const Displacement &displacement);
+
+  /**
+   * @brief Corrects the position with a GPS reading, if it is believable.
+   *
+   * @param reading
+   */
+  void correctPosition(const PositionReading &reading);
+
+  GPS *gps;
+  const Parameters params;
+  std::array<double, 3> state{};
+  Covariance covariance{};
+  Snapshot<Covariance> covarianceSnapshot;
+  double lastGPSX{0.0};
+  double lastGPSY{0.0};
+  pros::Mutex filterMutex;
+
+  static const Telemetry::Channel telemetryChannel;
+  static Metrics::Counter gpsUpdates;
+  static Metrics::Counter gpsRejections;
+};
+} // namespace atum
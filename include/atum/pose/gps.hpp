@@ -10,7 +10,9 @@
 #pragma once
 
 #include "../../pros/gps.hpp"
+#include "../utility/metrics.hpp"
 #include "tracker.hpp"
+#include <optional>
 
 namespace atum {
 /**
@@ -33,36 +35,42 @@ class GPS {
    *
    * Heading and pose trust refer to how the GPS readings are weighted in
    * comparison to other measurements upon getting heading or resetting
-   * trackers.
+   * trackers. Latency is how long readings take to come in after they are
+   * taken, so they are compared with the tracked pose at that time.
    *
    * @param port
    * @param offset
    * @param iHeadingTrust
    * @param iFullPoseTrust
    * @param loggerLevel
+   * @param iLatency
    */
   GPS(const std::int8_t port,
       const Pose &offset,
       const double iHeadingTrust = 0.5,
       const double iFullPoseTrust = 1.0,
-      const Logger::Level loggerLevel = Logger::Level::Info);
+      const Logger::Level loggerLevel = Logger::Level::Info,
+      const second_t iLatency = 0_s);
 
   /**
    * @brief Constructs a new GPS by finding its port dynamically.
    *
    * Heading and pose trust refer to how the GPS readings are weighted in
    * comparison to other measurements upon getting heading or resetting
-   * trackers.
+   * trackers. Latency is how long readings take to come in after they are
+   * taken, so they are compared with the tracked pose at that time.
    *
    * @param offset
    * @param iHeadingTrust
    * @param iFullPoseTrust
    * @param loggerLevel
+   * @param iLatency
    */
   GPS(const Pose &offset,
       const double iHeadingTrust = 0.5,
       const double iFullPoseTrust = 1.0,
-      const Logger::Level loggerLevel = Logger::Level::Info);
+      const Logger::Level loggerLevel = Logger::Level::Info,
+      const second_t iLatency = 0_s);
 
   /**
    * @brief Sets the current pose. Should be called at the beginning of routines
@@ -81,8 +89,30 @@ class GPS {
   Pose getPose();
 
   /**
-   * @brief Resets a given tracker by taking a weighted average with its current
-   * measured pose.
+   * @brief A position reading, the error the GPS reported with it, and when it
+   * was taken, going by the latency.
+   *
+   */
+  struct Reading {
+    meter_t x;
+    meter_t y;
+    meter_t error;
+    second_t t;
+  };
+
+  /**
+   * @brief Gets the latest position reading without mapping or logging it, so
+   * filters can poll it every update. Nothing is logged if the GPS isn't
+   * installed either, as check() does.
+   *
+   * @return std::optional<Reading> Empty if the GPS isn't installed.
+   */
+  std::optional<Reading> getReading();
+
+  /**
+   * @brief Resets a given tracker by taking a weighted average with the pose
+   * it had when the reading was taken, then correcting it with that through
+   * Tracker::correctPose so the motion since then is kept.
    *
    * Will rely entirely on the other reading if the GPS check fails or if the
    * current error is greater than the max error for the GPS.
@@ -129,6 +159,12 @@ class GPS {
   degree_t headingOffset;
   const double headingTrust;
   const double fullPoseTrust;
+  const second_t latency;
   Logger logger;
+
+  static Metrics::Counter appliedCorrections;
+  static Metrics::Counter rejectedCorrections;
+  static Metrics::Histogram corrections; // How far each moved the tracker.
+  static Metrics::Gauge errors;
 };
 } // namespace atum
\ No newline at end of file
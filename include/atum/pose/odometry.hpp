@@ -13,7 +13,10 @@
 #include "../devices/odometer.hpp"
 #include "../systems/drive.hpp"
 #include "../time/task.hpp"
+#include "../utility/metrics.hpp"
+#include "../utility/telemetry.hpp"
 #include "../utility/units.hpp"
+#include "derivativeEstimator.hpp"
 #include "tracker.hpp"
 
 namespace atum {
@@ -21,15 +24,36 @@ namespace atum {
  * @brief Performs tracking using two odometers perpendicular to eachother.
  * Uses arc estimation and twists for improved accuracy.
  *
+ * Each update integrates the motion since the last as an arc of constant
+ * curvature, which is exact as long as the curvature doesn't change within
+ * an update, so the faster it updates the less error builds on sharp turns.
+ * It updates every 10 ms, as the odometers' ADI encoders and the drive's motor
+ * positions only refresh that often, even though the IMU reports every 5 ms.
+ * Updating faster would see each encoder move in alternate updates only, so
+ * the velocities would swing between none and double. Consumers that don't
+ * need every pose should observe it with an interval instead.
+ *
+ * The velocities and accelerations of each pose are estimated from the
+ * distance driven forward and the heading by a DerivativeEstimator for each,
+ * which default to differencing each update.
+ *
  */
 class Odometry : public Tracker, public Task {
   TASK_BOILERPLATE(); // Included in all task derivatives for setup.
 
   public:
+  /**
+   * @brief How often odometry updates in the background, matching how often
+   * the ADI encoders and motor positions refresh.
+   *
+   */
+  static constexpr millisecond_t period{10};
+
   /**
    * @brief Constructs a new Odometry object. Expects an odometer parallel to
    * the direction of travel, an odometer perpendicular to the direction of
    * travel, and an IMU. If the drive is provided, it will be used to estimate dy. 
+   * Either estimator defaults to a FiniteDifference if not provided.
    *
    * The startBackgroundTasks() method will have to be called if you expect
    * tracking to be performed in the background.
@@ -39,12 +63,18 @@ class Odometry : public Tracker, public Task {
    * @param iImu
    * @param iDrive
    * @param loggerLevel
+   * @param iForwardEstimator Estimates the velocity and acceleration from the
+   * distance driven forward, in meters, so its noise is in meters too.
+   * @param iTurnEstimator Estimates the angular velocity and acceleration from
+   * the heading, in radians, so its noise is in radians too.
    */
   Odometry(std::unique_ptr<Odometer> iForward,
            std::unique_ptr<Odometer> iSide,
            std::unique_ptr<IMU> iImu,
            Drive *iDrive,
-           Logger::Level loggerLevel = Logger::Level::Info);
+           Logger::Level loggerLevel = Logger::Level::Info,
+           std::unique_ptr<DerivativeEstimator> iForwardEstimator = nullptr,
+           std::unique_ptr<DerivativeEstimator> iTurnEstimator = nullptr);
 
   /**
    * @brief Updates the current pose as tracked by the odometers.
@@ -54,23 +84,58 @@ class Odometry : public Tracker, public Task {
    */
   Pose update() override;
 
+  protected:
+  /**
+   * @brief How far the robot moved between updates, relative to where it
+   * faced at the start: dx to its right, dy forward, and dh clockwise, over
+   * dt.
+   *
+   */
+  struct Displacement {
+    inch_t dx;
+    inch_t dy;
+    radian_t dh;
+    second_t dt;
+  };
+
+  /**
+   * @brief Reads how far the robot moved since the last update, using arc
+   * estimation and accounting for its rotation along the way. Readings that
+   * aren't finite are logged and counted, and are taken as no movement.
+   *
+   * @return Displacement
+   */
+  Displacement measure();
+
+  /**
+   * @brief Fills in the velocities and accelerations of the pose, estimated
+   * from the displacement and those before it.
+   *
+   * @param pose
+   * @param displacement
+   */
+  void estimateMotion(Pose &pose, const Displacement &displacement);
+
   private:
   /**
-   * @brief Checks that dx, dy, and dh are finite, valid values before
-   * rotating them appropriately and adding them to the current pose
-   * estimate.
+   * @brief Rotates the displacement appropriately and adds it to the current
+   * pose estimate, without letting a correction land in between.
    *
-   * @param dx
-   * @param dy
-   * @param dh
+   * @param displacement
    * @return Pose
    */
-  Pose integratePose(inch_t dx, inch_t dy, radian_t dh);
+  Pose integratePose(const Displacement &displacement);
 
   std::unique_ptr<Odometer> forward;
   std::unique_ptr<Odometer> side;
   std::unique_ptr<IMU> imu;
   Drive* drive;
   Timer timer;
+  std::unique_ptr<DerivativeEstimator> forwardEstimator;
+  std::unique_ptr<DerivativeEstimator> turnEstimator;
+
+  static const Telemetry::Channel telemetryChannel;
+  static Metrics::Counter invalidReadings;
+  static Metrics::Histogram periods;
 };
 } // namespace atum
\ No newline at end of file
@@ -0,0 +1,194 @@
+/**
+ * @file particleFilter.hpp
+ * @brief Includes the ParticleFilter class.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../devices/distanceSensor.hpp"
+#include "../utility/metrics.hpp"
+#include "odometry.hpp"
+#include <vector>
+
+namespace atum {
+/**
+ * @brief Performs Monte Carlo localization, correcting odometry with the
+ * ranges distance sensors read to the field walls.
+ *
+ * A set of particles, each a guess at the pose, is moved by every
+ * displacement Odometry measures, with noise growing with how far the robot
+ * moved and turned. Once the robot has moved far enough since the last
+ * correction, each particle is weighed by how well the ranges it would expect
+ * to read, found by casting each sensor's beam to the walls, match the ones
+ * read. Particles that fit poorly are then dropped in favor of copies of those
+ * that fit well. The pose is the weighted mean of the particles.
+ *
+ * Readings past the sensor's range are ignored, and each is allowed some
+ * chance of having hit something other than a wall, like a game element or
+ * another robot, so a blocked sensor doesn't throw off the pose.
+ *
+ * The particles are kept as arrays of each field rather than an array of
+ * particles, sized once on construction, so each step is a loop over
+ * contiguous floats that the compiler can vectorize.
+ *
+ */
+class ParticleFilter : public Odometry {
+  public:
+  /**
+   * @brief A distance sensor and where it is on the robot: x to the right of
+   * and y in front of the center of rotation, facing h clockwise from
+   * forward.
+   *
+   */
+  struct Beam {
+    std::unique_ptr<DistanceSensor> sensor;
+    inch_t x;
+    inch_t y;
+    degree_t h;
+  };
+
+  /**
+   * @brief The particle count and the noise assumed in each source, as
+   * standard deviations.
+   *
+   */
+  struct Parameters {
+    std::size_t particles{500};
+    double translationNoise{0.05}; // Per inch traveled.
+    double rotationNoise{0.02};    // Per radian turned.
+    inch_t initialPositionNoise{1_in};
+    degree_t initialHeadingNoise{1_deg};
+    double rangeNoise{0.05}; // Of the range read.
+    millimeter_t minimumRangeNoise{15_mm};
+    // The chance of a reading having hit something other than a wall.
+    double outlierChance{0.05};
+    millimeter_t maximumRange{2000_mm};
+    // Half of the distance between the inner faces of opposite walls.
+    inch_t fieldHalfWidth{70.2_in};
+    // How far the robot moves or turns between corrections, so the same
+    // reading isn't counted again while still.
+    inch_t correctionDistance{1_in};
+    degree_t correctionAngle{2_deg};
+  };
+
+  /**
+   * @brief Constructs a new ParticleFilter, taking the same sensors as
+   * Odometry along with the distance sensors facing the walls.
+   *
+   * The startBackgroundTasks() method will have to be called if you expect
+   * tracking to be performed in the background.
+   *
+   * @param iForward
+   * @param iSide
+   * @param iImu
+   * @param iDrive
+   * @param iBeams
+   * @param iParams
+   * @param loggerLevel
+   */
+  ParticleFilter(std::unique_ptr<Odometer> iForward,
+                 std::unique_ptr<Odometer> iSide,
+                 std::unique_ptr<IMU> iImu,
+                 Drive *iDrive,
+                 std::vector<Beam> iBeams,
+                 const Parameters &iParams,
+                 const Logger::Level loggerLevel = Logger::Level::Info);
+
+  /**
+   * @brief Moves the particles by the displacement measured, and corrects
+   * them with the distance sensors if the robot has moved far enough.
+   *
+   * @return Pose
+   */
+  Pose update() override;
+
+  /**
+   * @brief Sets the current pose, scattering the particles around it by the
+   * initial noise given in the parameters.
+   *
+   * @param iPose
+   */
+  void setPose(const Pose &iPose) override;
+
+  protected:
+  /**
+   * @brief Moves every particle by the correction, rather than scattering
+   * them again as setPose does.
+   *
+   * @param correction
+   */
+  void correctState(const Correction &correction) override;
+
+  private:
+  /**
+   * @brief The particles, as an array for each field.
+   *
+   */
+  struct Particles {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> h;
+    std::vector<float> weight;
+  };
+
+  /**
+   * @brief Moves every particle by the displacement, with noise.
+   *
+   * @param displacement
+   */
+  void move(const Displacement &displacement);
+
+  /**
+   * @brief Weighs every particle by how well it matches each reading, then
+   * resamples if too few particles carry most of the weight.
+   *
+   * @param ranges The range each beam read in inches, or a negative number if
+   * it didn't read anything.
+   */
+  void correct(const std::vector<float> &ranges);
+
+  /**
+   * @brief Replaces the particles with copies drawn in proportion to their
+   * weights, using a single random offset.
+   *
+   */
+  void resample();
+
+  /**
+   * @brief Gets the weighted mean of the particles.
+   *
+   * @return Pose
+   */
+  Pose estimate() const;
+
+  /**
+   * @brief Returns uniform noise with a standard deviation of one.
+   *
+   * @return float
+   */
+  float noise();
+
+  std::vector<Beam> beams;
+  const Parameters params;
+  const std::size_t count;
+  Particles particles;
+  Particles resampled;
+  // The heading of each particle, taken once per correction for every beam.
+  std::vector<float> cosines;
+  std::vector<float> sines;
+  std::vector<float> readings;
+  std::uint32_t seed{2463534242};
+  double movedDistance{0.0};
+  double movedAngle{0.0};
+  float effectiveParticles{0.0f};
+  pros::Mutex filterMutex;
+
+  static const Telemetry::Channel telemetryChannel;
+  static Metrics::Counter corrections;
+  static Metrics::Counter resamples;
+};
+} // namespace atum
@@ -9,15 +9,32 @@
 
 #pragma once
 
+#include "../time/signal.hpp"
 #include "../time/timer.hpp"
 #include "../utility/logger.hpp"
+#include "../utility/snapshot.hpp"
 #include "pose.hpp"
+#include <array>
+#include <functional>
+#include <mutex>
+#include <vector>
 
 namespace atum {
 /**
  * @brief This class creates an interface for any system that can
  * do pose tracking.
  *
+ * The pose is published as a Snapshot, so it can be read from any task while
+ * the tracker's own task updates it, without either waiting on the other.
+ * Reading it does nothing else, so it is cheap enough for tight loops.
+ * Anything that wants to see every pose, such as the map and the debug log,
+ * observes the updates instead.
+ *
+ * The last poses set are also kept in a fixed ring buffer, so the pose at a
+ * given time in the last couple of seconds can be looked up. Measurements that
+ * arrive late, like GPS readings, can then be compared with where the robot
+ * was when they were taken rather than where it is now.
+ *
  */
 class Tracker {
   public:
@@ -28,6 +45,12 @@ class Tracker {
    */
   Tracker(const Logger::Level loggerLevel = Logger::Level::Info);
 
+  /**
+   * @brief A callback given each new pose.
+   *
+   */
+  using Observer = std::function<void(const Pose &)>;
+
   /**
    * @brief This method should update the current tracked pose.
    * It should be overriden in derivatives of Tracker.
@@ -37,7 +60,8 @@ class Tracker {
   virtual Pose update() = 0;
 
   /**
-   * @brief Sets the current pose of the tracker.
+   * @brief Sets the current pose of the tracker, stamping it with the current
+   * time.
    *
    * @param iPose
    */
@@ -50,8 +74,167 @@ class Tracker {
    */
   virtual Pose getPose();
 
+  /**
+   * @brief Gets the pose the tracker had at the given time, interpolated
+   * between the poses set around it. Times before the oldest pose kept give
+   * the oldest pose, and times after the newest give the newest.
+   *
+   * Unlike getPose(), this waits for the write lock, so it shouldn't be called
+   * from tight loops.
+   *
+   * @param time
+   * @return Pose
+   */
+  Pose getPose(const second_t time);
+
+  /**
+   * @brief Corrects the tracker with a pose measured at the time it is
+   * stamped with. The poses kept from then on, and the current pose, are
+   * moved and turned the same way the pose at that time has to be to match the
+   * measurement, so the motion tracked since it was taken is kept.
+   *
+   * The corrected pose is set under the same lock, rather than through
+   * setPose(), so a pose set in between can't be lost and trackers don't reset
+   * their own state. They move it with correctState() instead.
+   *
+   * @param measured
+   */
+  void correctPose(const Pose &measured);
+
+  /**
+   * @brief Calls the observer with every decimation-th pose set, such as once
+   * every ten odometry updates with a decimation of 10. Observers are called
+   * from the task setting the pose while it holds the write lock, so they
+   * should be quick and must not set the pose themselves.
+   *
+   * @param observer
+   * @param decimation
+   */
+  void addObserver(const Observer &observer, const std::size_t decimation = 1);
+
+  /**
+   * @brief Calls the observer with a pose at most once every interval, going
+   * by the times poses are stamped with, so how often it is called doesn't
+   * depend on how often the pose is updated. Otherwise the same as observing
+   * with a decimation.
+   *
+   * @param observer
+   * @param interval
+   */
+  void addObserver(const Observer &observer, const second_t interval);
+
+  /**
+   * @brief Gets the signal raised whenever the position or heading of the
+   * tracked pose changes, so conditions on the pose can be checked only when
+   * there is something new to check.
+   *
+   * @return const Signal&
+   */
+  const Signal &getChangeSignal() const;
+
   protected:
+  /**
+   * @brief How correctPose moves a pose: turned about where the robot was when
+   * the measurement was taken, and moved to where it was measured to be.
+   *
+   */
+  struct Correction {
+    Pose then;
+    Pose measured;
+    radian_t turn;
+
+    /**
+     * @brief Moves and turns the pose by the correction.
+     *
+     * @param moved
+     */
+    void apply(Pose &moved) const;
+  };
+
+  /**
+   * @brief Moves any state the tracker keeps of its own, such as a filter's
+   * estimate, by a correction to the pose. Called by correctPose with the
+   * write lock held, so must not set or look up the pose. Does nothing by
+   * default, as the pose is all a plain tracker keeps.
+   *
+   * @param correction
+   */
+  virtual void correctState(const Correction &correction);
+
+  /**
+   * @brief Steps the current pose and sets the result, stamped with the
+   * current time, all under the write lock, so a correction can't land
+   * between reading the pose and setting it. The step is called with the lock
+   * held, so must not set or look up the pose itself.
+   *
+   * @tparam Step A callable taking the pose to step by reference.
+   * @param step
+   * @return Pose
+   */
+  template <typename Step> Pose stepPose(Step &&step) {
+    std::scoped_lock lock{writeMutex};
+    Pose stepped{pose.load()};
+    step(stepped);
+    stepped.t = preciseTime();
+    store(stepped);
+    return stepped;
+  }
+
   Logger logger;
-  Pose pose;
+
+  private:
+  /**
+   * @brief An observer and how many poses it has skipped, or for observers
+   * with an interval, when the next pose is due.
+   *
+   */
+  struct Subscription {
+    Observer observer;
+    std::size_t decimation;
+    std::size_t skipped;
+    second_t interval;
+    second_t due;
+  };
+
+  // The map trail is drawn at 20 Hz and the pose is logged at 10 Hz, however
+  // fast the pose is updated.
+  static constexpr millisecond_t mapInterval{50};
+  static constexpr millisecond_t logInterval{100};
+
+  // A couple of seconds of poses at the odometry rate.
+  static constexpr std::size_t historySize{256};
+
+  /**
+   * @brief Publishes the stamped pose, keeps it in the history, and notifies
+   * the observers. The write lock must be held.
+   *
+   * @param stamped
+   */
+  void store(const Pose &stamped);
+
+  /**
+   * @brief Gets the pose the given number of poses after the oldest one kept.
+   *
+   * @param index
+   * @return Pose&
+   */
+  Pose &historyAt(const std::size_t index);
+
+  /**
+   * @brief Interpolates between the poses kept, without locking.
+   *
+   * @param time
+   * @return Pose
+   */
+  Pose interpolate(const second_t time);
+
+  Snapshot<Pose> pose;
+  // Readers never lock, but writers still need to take turns.
+  pros::Mutex writeMutex;
+  Signal changeSignal;
+  std::vector<Subscription> subscriptions;
+  std::array<Pose, historySize> history;
+  std::size_t historyStart{0};
+  std::size_t historyCount{0};
 };
 } // namespace atum
\ No newline at end of file
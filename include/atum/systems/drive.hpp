@@ -11,6 +11,7 @@
 
 #include "../devices/motor.hpp"
 #include "../pose/tracker.hpp"
+#include "../time/conditions.hpp"
 #include "../utility/logger.hpp"
 #include "../utility/misc.hpp"
 #include "api.h"
@@ -54,7 +55,7 @@ class Drive {
 
   /**
    * @brief Sets the tracker for the drive. Should be ran before performing
-   * motions.
+   * motions. Conditions from checkIsNear follow the new tracker.
    *
    * @param iTracker
    */
@@ -150,7 +151,8 @@ class Drive {
   /**
    * @brief A condition to be used for scheduling or waiting. Returns a function
    * that, when called, returns true if the drive is within the threshold of the
-   * given pose.
+   * given pose. The distance is only measured again once the tracker has a new
+   * pose.
    *
    * @param pose
    * @param within
@@ -161,6 +163,10 @@ class Drive {
   private:
   std::unique_ptr<Motor> left;
   std::unique_ptr<Motor> right;
+  // Raised when the tracked pose moves or the tracker is replaced, so
+  // conditions on the pose follow whichever tracker is set. Declared before
+  // the tracker so it outlives the tracker's observer.
+  Signal changeSignal;
   std::unique_ptr<Tracker> tracker;
   const Geometry geometry;
   degree_t previousTraveled{0_deg};
@@ -12,9 +12,10 @@
 #include "../devices/motor.hpp"
 #include "../time/task.hpp"
 #include "../time/time.hpp"
+#include "../utility/ringBuffer.hpp"
 #include "../utility/units.hpp"
 #include "api.h"
-#include <queue>
+#include <bit>
 
 namespace atum {
 /**
@@ -156,12 +157,18 @@ class Remote : public Task {
    */
   static constexpr double deadzone{0.25};
 
+  static constexpr std::size_t lineLength{19};
+  static constexpr std::size_t printQueueSize{3};
+  // Padded to the full width so it overwrites the previous text.
+  using Line = std::array<char, lineLength + 1>;
+
   pros::Controller remote;
   Logger logger;
-  std::array<std::queue<std::string>, 3> rowQueues;
+  // The ring buffer's capacity must be a power of two, so print() keeps each
+  // line to printQueueSize itself.
+  std::array<RingBuffer<Line, std::bit_ceil(printQueueSize)>, 3> rowQueues;
+  std::size_t printLine{0};
   static constexpr double analogToVolt{Motor::maxVoltage / 127.0};
-  static const std::string linePadding;
-  static constexpr std::size_t printQueueSize{3};
   static constexpr second_t minimumPrintDelay{75_ms};
 };
 } // namespace atum
\ No newline at end of file
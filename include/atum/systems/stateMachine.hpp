@@ -40,7 +40,7 @@ class StateMachine {
    * @return Condition
    */
   Condition checkStateIs(const State desired) {
-    return [=]() { return state == desired; };
+    return [=, this]() { return state == desired; };
   }
 
   protected:
@@ -0,0 +1,394 @@
+/**
+ * @file conditions.hpp
+ * @brief Includes the condition expression templates and the functions used to
+ * build them.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "signal.hpp"
+#include <concepts>
+#include <utility>
+
+namespace atum {
+/**
+ * @brief Base of every condition expression. Expressions are callables that
+ * return a boolean, like a Condition, but they hold everything they need by
+ * value and are combined at compile time, so checking one never allocates.
+ *
+ * Build them with when, then combine them with &&, ||, !, risingEdge,
+ * debounce, and heldFor. An expression converts to a Condition wherever one
+ * is needed, which allocates once when converted rather than on every check.
+ *
+ * Expressions with memory (risingEdge, debounce, and heldFor) must be checked
+ * regularly to notice changes, so && and || check them even when the other
+ * side already decided the result.
+ *
+ * For example, to wait until the robot has been near a pose for 200 ms, or the
+ * limit switch has been pressed, only measuring the distance when the tracker
+ * pushes a new pose:
+ *
+ * waitUntil(heldFor(when(tracker->getChangeSignal(), nearGoal), 200_ms) ||
+ *           when(limitSwitch->getChangeSignal(),
+ *                [=]() { return limitSwitch->isPressed(); }));
+ *
+ */
+struct ConditionExpression {
+  /**
+   * @brief Whether the expression remembers earlier checks, and so must be
+   * checked every time for its result to stay correct.
+   *
+   */
+  static constexpr bool stateful{false};
+};
+
+/**
+ * @brief Any condition expression.
+ *
+ * @tparam E
+ */
+template <typename E>
+concept ConditionExpressionType = std::derived_from<E, ConditionExpression>;
+
+/**
+ * @brief A condition expression that calls the given function on every check.
+ *
+ * @tparam F
+ */
+template <typename F>
+class Predicate : public ConditionExpression {
+  public:
+  explicit Predicate(F iFunction) : function{std::move(iFunction)} {}
+
+  bool operator()() {
+    return function();
+  }
+
+  private:
+  F function;
+};
+
+/**
+ * @brief A condition expression that only calls the given function again once
+ * the given signal has been raised, and otherwise reuses its last result. The
+ * source behind the signal pushes its changes, so nothing is recomputed while
+ * it stays the same.
+ *
+ * @tparam F
+ */
+template <typename F>
+class Watched : public ConditionExpression {
+  public:
+  Watched(const Signal &iSignal, F iFunction) :
+      signal{&iSignal},
+      function{std::move(iFunction)} {}
+
+  bool operator()() {
+    const std::uint32_t current{signal->getGeneration()};
+    if(!checked || current != generation) {
+      // Read first so a change while checking is noticed next time.
+      generation = current;
+      checked = true;
+      result = function();
+    }
+    return result;
+  }
+
+  private:
+  const Signal *signal;
+  F function;
+  std::uint32_t generation{0};
+  bool checked{false};
+  bool result{false};
+};
+
+/**
+ * @brief A condition expression that is met when both sides are.
+ *
+ * @tparam L
+ * @tparam R
+ */
+template <ConditionExpressionType L, ConditionExpressionType R>
+class And : public ConditionExpression {
+  public:
+  static constexpr bool stateful{L::stateful || R::stateful};
+
+  And(L iLeft, R iRight) : left{std::move(iLeft)}, right{std::move(iRight)} {}
+
+  bool operator()() {
+    if constexpr(R::stateful) {
+      const bool leftMet{left()};
+      return right() && leftMet;
+    } else {
+      return left() && right();
+    }
+  }
+
+  private:
+  L left;
+  R right;
+};
+
+/**
+ * @brief A condition expression that is met when either side is.
+ *
+ * @tparam L
+ * @tparam R
+ */
+template <ConditionExpressionType L, ConditionExpressionType R>
+class Or : public ConditionExpression {
+  public:
+  static constexpr bool stateful{L::stateful || R::stateful};
+
+  Or(L iLeft, R iRight) : left{std::move(iLeft)}, right{std::move(iRight)} {}
+
+  bool operator()() {
+    if constexpr(R::stateful) {
+      const bool leftMet{left()};
+      return right() || leftMet;
+    } else {
+      return left() || right();
+    }
+  }
+
+  private:
+  L left;
+  R right;
+};
+
+/**
+ * @brief A condition expression that is met when the given one isn't.
+ *
+ * @tparam E
+ */
+template <ConditionExpressionType E>
+class Not : public ConditionExpression {
+  public:
+  static constexpr bool stateful{E::stateful};
+
+  explicit Not(E iExpression) : expression{std::move(iExpression)} {}
+
+  bool operator()() {
+    return !expression();
+  }
+
+  private:
+  E expression;
+};
+
+/**
+ * @brief A condition expression that is met only on the first check after the
+ * given one becomes met.
+ *
+ * @tparam E
+ */
+template <ConditionExpressionType E>
+class RisingEdge : public ConditionExpression {
+  public:
+  static constexpr bool stateful{true};
+
+  explicit RisingEdge(E iExpression) : expression{std::move(iExpression)} {}
+
+  bool operator()() {
+    const bool met{expression()};
+    const bool rose{met && !previous};
+    previous = met;
+    return rose;
+  }
+
+  private:
+  E expression;
+  bool previous{false};
+};
+
+/**
+ * @brief A condition expression that is met once the given one has been met
+ * on every check for the given duration.
+ *
+ * @tparam E
+ */
+template <ConditionExpressionType E>
+class HeldFor : public ConditionExpression {
+  public:
+  static constexpr bool stateful{true};
+
+  HeldFor(E iExpression, const second_t iDuration) :
+      expression{std::move(iExpression)},
+      duration{iDuration} {}
+
+  bool operator()() {
+    const second_t now{time()};
+    if(!expression()) {
+      held = false;
+      return false;
+    }
+    if(!held) {
+      held = true;
+      since = now;
+    }
+    return now - since >= duration;
+  }
+
+  private:
+  E expression;
+  second_t duration;
+  second_t since{0_s};
+  bool held{false};
+};
+
+/**
+ * @brief A condition expression that follows the given one, but only changes
+ * once the given one has held its new result for the given duration, ignoring
+ * any bouncing in between.
+ *
+ * @tparam E
+ */
+template <ConditionExpressionType E>
+class Debounce : public ConditionExpression {
+  public:
+  static constexpr bool stateful{true};
+
+  Debounce(E iExpression, const second_t iDuration) :
+      expression{std::move(iExpression)},
+      duration{iDuration} {}
+
+  bool operator()() {
+    const second_t now{time()};
+    const bool met{expression()};
+    if(met == output) {
+      changing = false;
+      return output;
+    }
+    if(!changing) {
+      changing = true;
+      since = now;
+    }
+    if(now - since >= duration) {
+      output = met;
+      changing = false;
+    }
+    return output;
+  }
+
+  private:
+  E expression;
+  second_t duration;
+  second_t since{0_s};
+  bool changing{false};
+  bool output{false};
+};
+
+/**
+ * @brief Makes a condition expression out of a function returning a boolean,
+ * which is called on every check.
+ *
+ * @tparam F
+ * @param function
+ * @return Predicate<F>
+ */
+template <typename F>
+Predicate<F> when(F function) {
+  return Predicate<F>{std::move(function)};
+}
+
+/**
+ * @brief Makes a condition expression out of a function returning a boolean,
+ * which is only called again once the given signal has been raised.
+ *
+ * @tparam F
+ * @param signal
+ * @param function
+ * @return Watched<F>
+ */
+template <typename F>
+Watched<F> when(const Signal &signal, F function) {
+  return Watched<F>{signal, std::move(function)};
+}
+
+/**
+ * @brief Makes a condition expression that is met when both of the given ones
+ * are.
+ *
+ * @tparam L
+ * @tparam R
+ * @param left
+ * @param right
+ * @return And<L, R>
+ */
+template <ConditionExpressionType L, ConditionExpressionType R>
+And<L, R> operator&&(L left, R right) {
+  return And<L, R>{std::move(left), std::move(right)};
+}
+
+/**
+ * @brief Makes a condition expression that is met when either of the given
+ * ones is.
+ *
+ * @tparam L
+ * @tparam R
+ * @param left
+ * @param right
+ * @return Or<L, R>
+ */
+template <ConditionExpressionType L, ConditionExpressionType R>
+Or<L, R> operator||(L left, R right) {
+  return Or<L, R>{std::move(left), std::move(right)};
+}
+
+/**
+ * @brief Makes a condition expression that is met when the given one isn't.
+ *
+ * @tparam E
+ * @param expression
+ * @return Not<E>
+ */
+template <ConditionExpressionType E>
+Not<E> operator!(E expression) {
+  return Not<E>{std::move(expression)};
+}
+
+/**
+ * @brief Makes a condition expression that is met only on the first check
+ * after the given one becomes met.
+ *
+ * @tparam E
+ * @param expression
+ * @return RisingEdge<E>
+ */
+template <ConditionExpressionType E>
+RisingEdge<E> risingEdge(E expression) {
+  return RisingEdge<E>{std::move(expression)};
+}
+
+/**
+ * @brief Makes a condition expression that is met once the given one has been
+ * met for the given duration.
+ *
+ * @tparam E
+ * @param expression
+ * @param duration
+ * @return HeldFor<E>
+ */
+template <ConditionExpressionType E>
+HeldFor<E> heldFor(E expression, const second_t duration) {
+  return HeldFor<E>{std::move(expression), duration};
+}
+
+/**
+ * @brief Makes a condition expression that only changes once the given one
+ * has held its new result for the given duration.
+ *
+ * @tparam E
+ * @param expression
+ * @param duration
+ * @return Debounce<E>
+ */
+template <ConditionExpressionType E>
+Debounce<E> debounce(E expression, const second_t duration) {
+  return Debounce<E>{std::move(expression), duration};
+}
+} // namespace atum
@@ -0,0 +1,265 @@
+/**
+ * @file coroutine.hpp
+ * @brief Includes the Coroutine class and the functions used to build
+ * routines out of actions that overlap.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "time.hpp"
+#include <coroutine>
+#include <memory>
+#include <vector>
+
+namespace atum {
+/**
+ * @brief This class is a coroutine that can wait on actions without blocking
+ * the task it runs on, so several can be in progress at once. A function
+ * returning Coroutine may use co_await on other routines, such as those made by
+ * sleep, until, async, whenAll, whenAny, and withTimeout, and runs one step
+ * at a time until it is finished.
+ *
+ * Nothing runs until the routine is either awaited by another routine or
+ * given to run, which drives it (and everything it awaits) from the calling
+ * task, checking on whatever it is waiting for every standard delay.
+ *
+ * Destroying a routine that hasn't finished cancels it along with whatever it
+ * was waiting on, which is how whenAny and withTimeout stop the actions that
+ * lose.
+ *
+ * For example, to drive while waiting for a goal, but for no more than 3 s:
+ *
+ * co_await withTimeout(whenAll(moveTo->async([=]() { moveTo->forward(goal); }),
+ *                              until([=]() { return clamp->hasGoal(); })),
+ *                      3_s);
+ *
+ */
+class Coroutine {
+  public:
+  class Runner;
+
+  /**
+   * @brief Keeps the state of the coroutine. Used by the compiler.
+   *
+   */
+  struct promise_type {
+    Runner *runner{nullptr};
+    std::coroutine_handle<> continuation{};
+
+    Coroutine get_return_object();
+    std::suspend_always initial_suspend() noexcept;
+
+    struct FinalAwaiter {
+      bool await_ready() noexcept;
+      std::coroutine_handle<>
+          await_suspend(std::coroutine_handle<promise_type> handle) noexcept;
+      void await_resume() noexcept;
+    };
+
+    FinalAwaiter final_suspend() noexcept;
+    void return_void();
+    void unhandled_exception();
+  };
+
+  /**
+   * @brief Base for anything a routine can wait on that finishes on its own
+   * time. The runner checks it every standard delay and resumes the routine
+   * waiting on it once it is ready.
+   *
+   */
+  class Waiter {
+    public:
+    Waiter() = default;
+    Waiter(const Waiter &) = delete;
+
+    /**
+     * @brief Stops the runner from checking on the waiter if it is destroyed
+     * before it is ready.
+     *
+     */
+    virtual ~Waiter();
+
+    bool await_ready();
+
+    /**
+     * @brief Starts whatever is being waited on and has the runner of the
+     * awaiting routine check on it.
+     *
+     * @param handle
+     * @return true The routine is suspended until the waiter is ready.
+     * @return false It was ready immediately.
+     */
+    bool await_suspend(std::coroutine_handle<promise_type> handle);
+
+    void await_resume();
+
+    protected:
+    /**
+     * @brief Starts whatever is being waited on, once it is known who is
+     * waiting on it.
+     *
+     */
+    virtual void start();
+
+    /**
+     * @brief Says if whatever is being waited on has finished.
+     *
+     * @return true
+     * @return false
+     */
+    virtual bool ready() = 0;
+
+    Runner *runner{nullptr};
+
+    private:
+    friend class Runner;
+    std::coroutine_handle<> handle{};
+  };
+
+  Coroutine(Coroutine &&other) noexcept;
+  Coroutine &operator=(Coroutine &&other) noexcept;
+  Coroutine(const Coroutine &) = delete;
+
+  /**
+   * @brief Destroys the coroutine, cancelling it if it hasn't finished.
+   *
+   */
+  ~Coroutine();
+
+  /**
+   * @brief Runs the routine to completion, blocking the calling task.
+   *
+   */
+  void run();
+
+  /**
+   * @brief Says if the routine has finished.
+   *
+   * @return true
+   * @return false
+   */
+  bool isDone() const;
+
+  /**
+   * @brief Lets routines await other routines, running them to completion
+   * before continuing.
+   *
+   * @return auto
+   */
+  auto operator co_await() && {
+    struct Awaiter {
+      std::coroutine_handle<promise_type> child;
+      bool await_ready() {
+        return !child || child.done();
+      }
+      std::coroutine_handle<>
+          await_suspend(std::coroutine_handle<promise_type> parent) {
+        child.promise().runner = parent.promise().runner;
+        child.promise().continuation = parent;
+        return child;
+      }
+      void await_resume() {}
+    };
+    return Awaiter{handle};
+  }
+
+  private:
+  friend class Runner;
+
+  explicit Coroutine(std::coroutine_handle<promise_type> iHandle);
+
+  std::coroutine_handle<promise_type> handle;
+};
+
+/**
+ * @brief Makes a routine that finishes after the given time.
+ *
+ * @param duration
+ * @return Coroutine
+ */
+Coroutine sleep(const second_t duration);
+
+/**
+ * @brief Makes a routine that finishes once the condition is met.
+ *
+ * @param condition
+ * @return Coroutine
+ */
+Coroutine until(const Condition condition);
+
+/**
+ * @brief Makes a routine that runs a blocking action on its own task and
+ * finishes when the action does. If the routine is cancelled first, cancel is
+ * called to make the action stop early, such as by interrupting a motion.
+ *
+ * @param action
+ * @param cancel
+ * @return Coroutine
+ */
+Coroutine async(const std::function<void()> action,
+              const std::function<void()> cancel = {});
+
+/**
+ * @brief Makes a routine that runs all of the given routines at once and
+ * finishes when they all have.
+ *
+ * @param routines
+ * @return Coroutine
+ */
+Coroutine whenAll(std::vector<Coroutine> routines);
+
+/**
+ * @brief Makes a routine that runs all of the given routines at once and
+ * finishes when any of them has, cancelling the rest.
+ *
+ * @param routines
+ * @return Coroutine
+ */
+Coroutine whenAny(std::vector<Coroutine> routines);
+
+/**
+ * @brief Runs all of the given routines at once and finishes when they all
+ * have.
+ *
+ * @tparam Routines
+ * @param routines
+ * @return Coroutine
+ */
+template <typename... Routines>
+Coroutine whenAll(Coroutine first, Routines... rest) {
+  std::vector<Coroutine> routines;
+  routines.push_back(std::move(first));
+  (routines.push_back(std::move(rest)), ...);
+  return whenAll(std::move(routines));
+}
+
+/**
+ * @brief Runs all of the given routines at once and finishes when any of them
+ * has, cancelling the rest.
+ *
+ * @tparam Routines
+ * @param routines
+ * @return Coroutine
+ */
+template <typename... Routines>
+Coroutine whenAny(Coroutine first, Routines... rest) {
+  std::vector<Coroutine> routines;
+  routines.push_back(std::move(first));
+  (routines.push_back(std::move(rest)), ...);
+  return whenAny(std::move(routines));
+}
+
+/**
+ * @brief Makes a routine that runs the given one, cancelling it if it takes
+ * longer than the timeout.
+ *
+ * @param routine
+ * @param timeout
+ * @return Coroutine
+ */
+Coroutine withTimeout(Coroutine routine, const second_t timeout);
+} // namespace atum
@@ -0,0 +1,83 @@
+/**
+ * @file executor.hpp
+ * @brief Includes the Executor class.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../utility/logger.hpp"
+#include "taskStats.hpp"
+#include "time.hpp"
+
+namespace atum {
+/**
+ * @brief This class runs periodic callbacks at fixed rates without giving each
+ * one its own task. Callbacks sharing a priority share one worker task, which
+ * runs whichever are due in rate-monotonic order (shortest period first) and
+ * then sleeps until the next release with delay_until, so periods do not drift.
+ *
+ * A callback that is still running when its next release comes due has overran
+ * its period. Overruns are counted and logged, and missed releases are skipped
+ * rather than ran back to back.
+ *
+ * Callbacks must not block, as that would hold up every other callback on
+ * their worker. Blocking loops should stay on their own tasks.
+ *
+ */
+class Executor {
+  public:
+  /**
+   * @brief Identifies a registered callback.
+   *
+   */
+  using Handle = std::size_t;
+
+  /**
+   * @brief Registers a callback to be ran every period on the worker for the
+   * given priority, starting that worker if needed. The first run is
+   * immediate.
+   *
+   * @param name
+   * @param period
+   * @param priority
+   * @param callback
+   * @param stats Where to record the timing of each run, if anywhere.
+   * @return Handle
+   */
+  static Handle add(const std::string &name,
+                    const second_t period,
+                    const std::uint32_t priority,
+                    const std::function<void()> &callback,
+                    TaskStats *stats = nullptr);
+
+  /**
+   * @brief Stops running the callback with the given handle. A run already in
+   * progress is waited for, so whatever the callback uses can be destroyed once
+   * this returns, unless the callback is removing itself.
+   *
+   * @param handle
+   */
+  static void remove(const Handle handle);
+
+  /**
+   * @brief Gets the number of times the callback with the given handle has
+   * overran its period.
+   *
+   * @param handle
+   * @return std::uint32_t
+   */
+  static std::uint32_t getOverruns(const Handle handle);
+
+  private:
+  /**
+   * @brief The loop ran by the worker task for a given priority.
+   *
+   * @param priority
+   */
+  static void work(const std::uint32_t priority);
+};
+} // namespace atum
@@ -0,0 +1,79 @@
+/**
+ * @file rate.hpp
+ * @brief Includes the Rate class.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "taskStats.hpp"
+#include "time.hpp"
+
+namespace atum {
+/**
+ * @brief This class keeps a loop running at a fixed rate. Unlike calling wait
+ * at the end of each iteration, which waits a fixed time on top of however long
+ * the iteration took, it wakes at absolute times one period apart so the loop
+ * does not drift.
+ *
+ * If an iteration runs so long that a whole period is missed, the missed wakes
+ * are skipped rather than ran back to back. How late the loop woke up overall
+ * is kept as its slip.
+ *
+ */
+class Rate {
+  public:
+  /**
+   * @brief Constructs a new Rate that wakes once every period, starting now.
+   *
+   * @param iPeriod
+   */
+  explicit Rate(const second_t iPeriod = standardDelay);
+
+  /**
+   * @brief Times the loop from now, as if it had just started, and clears the
+   * measurements.
+   *
+   */
+  void reset();
+
+  /**
+   * @brief Waits until the next wake time, one period after the last.
+   *
+   */
+  void wait();
+
+  /**
+   * @brief Gets the period between wakes.
+   *
+   * @return second_t
+   */
+  second_t getPeriod() const;
+
+  /**
+   * @brief Gets the number of wakes per second actually achieved since the
+   * last reset.
+   *
+   * @return hertz_t
+   */
+  hertz_t getFrequency() const;
+
+  /**
+   * @brief Gets how late, in total, the loop has woken up since the last
+   * reset, including any skipped periods.
+   *
+   * @return second_t
+   */
+  second_t getSlip() const;
+
+  private:
+  std::uint32_t period;
+  std::uint32_t start;
+  std::uint32_t next;
+  std::uint32_t wakes{0};
+  std::uint32_t slip{0};
+};
+} // namespace atum
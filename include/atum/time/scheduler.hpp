@@ -9,9 +9,11 @@
 
 #pragma once
 
+#include "../utility/ringBuffer.hpp"
+#include "signal.hpp"
 #include "task.hpp"
 #include "timer.hpp"
-#include <queue>
+#include <limits>
 
 
 namespace atum {
@@ -20,6 +22,11 @@ namespace atum {
  * are met. Items will be interrupted if the competition state changes or the
  * object goes out of scope. Actions should be fairly simple.
  *
+ * Every pending item is checked each time the scheduler wakes, so a slow item
+ * never holds up the ones scheduled after it. The scheduler sleeps until the
+ * next check or the nearest timeout, kept in order in a heap, and is woken
+ * early whenever something is scheduled.
+ *
  */
 class Scheduler : public Task {
   TASK_BOILERPLATE(); // Included in all task derivatives for setup.
@@ -39,6 +46,19 @@ class Scheduler : public Task {
    */
   static const Condition neverMet;
 
+  /**
+   * @brief Identifies a scheduled item so it can be cancelled.
+   *
+   */
+  using Handle = std::uint32_t;
+
+  /**
+   * @brief The handle returned when an item could not be scheduled. Cancelling
+   * it does nothing.
+   *
+   */
+  static constexpr Handle invalidHandle{std::numeric_limits<Handle>::max()};
+
   /**
    * @brief The necessary parameters for a schedule item. Once the condition is
    * true, the todo method will be ran.
@@ -52,6 +72,12 @@ class Scheduler : public Task {
     second_t timeout{forever};
     // Unless provided, the default timeout action is the todo action.
     std::optional<std::function<void()>> todoTimeout{};
+    // If provided, the item is scheduled again this long after it finishes
+    // rather than being removed.
+    std::optional<second_t> repeatAfter{};
+    // If provided, the condition is only checked again once one of these has
+    // been raised. They must outlive the item.
+    std::vector<const Signal *> inputs{};
   };
 
   /**
@@ -69,13 +95,76 @@ class Scheduler : public Task {
   ~Scheduler();
 
   /**
-   * @brief Schedules an item to be performed when its criteria are met.
+   * @brief Schedules an item to be performed when its criteria are met. The
+   * item is dropped with a warning if too many are scheduled at once for the
+   * scheduler to take in.
    *
    * @param toSchedule
+   * @return Handle invalidHandle if the item was dropped.
    */
-  void schedule(const Scheduler::Item &toSchedule);
+  Handle schedule(const Scheduler::Item &toSchedule);
+
+  /**
+   * @brief Removes the item with the given handle before it is performed
+   * (again, for repeating items). Does nothing if it is no longer scheduled.
+   *
+   * @param handle
+   */
+  void cancel(const Handle handle);
 
   private:
+  /**
+   * @brief A scheduled item along with what the scheduler needs to track it.
+   *
+   */
+  struct Pending {
+    Item item;
+    Handle handle;
+    // The competition status when it was scheduled.
+    std::uint8_t status;
+    // The condition isn't checked before this time, for repeating items.
+    second_t armed;
+    second_t deadline;
+    std::vector<std::uint32_t> generations{};
+    bool done{false};
+  };
+
+  /**
+   * @brief Moves newly scheduled and cancelled items into the pending list.
+   * Only the scheduler's task touches the pending list, so items can be
+   * scheduled and cancelled from any task, their own actions included, without
+   * locking.
+   *
+   */
+  void takeRequests();
+
+  /**
+   * @brief Starts (or restarts) timing the item from the given time.
+   *
+   * @param item
+   * @param start
+   */
+  void arm(Pending &item, const second_t start);
+
+  /**
+   * @brief Says if the item's condition needs checking, which is whenever one
+   * of its inputs has been raised, or always if it has none.
+   *
+   * @param item
+   * @return true
+   * @return false
+   */
+  bool inputsChanged(Pending &item);
+
+  /**
+   * @brief Runs the item's action (or its timeout action) and either removes
+   * it or schedules it again.
+   *
+   * @param item
+   * @param timedOut
+   */
+  void perform(Pending &item, const bool timedOut);
+
   /**
    * @brief Higher than standard delay to allow several scheduled items at once
    * with little impact.
@@ -83,7 +172,21 @@ class Scheduler : public Task {
    */
   static constexpr second_t schedulerLoopDelay{100_ms};
 
-  std::queue<Item> scheduled;
+  /**
+   * @brief How many items can be scheduled or cancelled between two passes of
+   * the scheduler.
+   *
+   */
+  static constexpr std::size_t maxRequests{64};
+
+  std::vector<Pending> pending;
+  // A min-heap of when each pending item times out or is rearmed. Entries for
+  // finished items are discarded as they come up.
+  std::vector<std::pair<second_t, Handle>> wakeTimes;
+  RingBuffer<Pending, maxRequests> requested;
+  RingBuffer<Handle, maxRequests> cancelled;
+  std::atomic<Handle> nextHandle{0};
+  std::atomic<pros::task_t> loopTask{nullptr};
   Logger logger;
 };
-} // namespace atum
\ No newline at end of file
+} // namespace atum
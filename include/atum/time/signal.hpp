@@ -0,0 +1,41 @@
+/**
+ * @file signal.hpp
+ * @brief Includes the Signal class.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "time.hpp"
+#include <atomic>
+
+namespace atum {
+/**
+ * @brief This class lets a source announce that something it provides has
+ * changed, so anything depending on it knows it needs to look again. It only
+ * counts changes, so raising it is cheap enough to do from any task.
+ *
+ */
+class Signal {
+  public:
+  /**
+   * @brief Announces that whatever the signal represents has changed.
+   *
+   */
+  void raise();
+
+  /**
+   * @brief Gets how many times the signal has been raised, for comparison with
+   * an earlier value to tell if it has been raised since.
+   *
+   * @return std::uint32_t
+   */
+  std::uint32_t getGeneration() const;
+
+  private:
+  std::atomic<std::uint32_t> generation{0};
+};
+} // namespace atum
@@ -13,6 +13,8 @@
 #include "../utility/logger.hpp"
 #include "../utility/misc.hpp"
 #include "api.h"
+#include "executor.hpp"
+#include "taskStats.hpp"
 
 namespace atum {
 /**
@@ -45,21 +47,53 @@ namespace atum {
  * explicitly, ust START_TASK instead.
  *
  */
-#define START_TASK_1(name) taskParams.push_back({name, TASK_PRIORITY_DEFAULT, [=](){
+#define START_TASK_1(name) taskParams.push_back({name, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, std::nullopt, [=, this](){
 /**
  * @brief Start the definition of a task with its name and priority. Do not use
  * explicity, use START_TASK instead.
  *
  */
-#define START_TASK_2(name, priority) taskParams.push_back({name, priority, [=](){
+#define START_TASK_2(name, priority) taskParams.push_back({name, priority, TASK_STACK_DEPTH_DEFAULT, std::nullopt, [=, this](){
 /**
- * @brief Starts the definition of a task. Accepts between one and two
+ * @brief Start the definition of a task with its name, priority, and stack
+ * depth. Do not use explicity, use START_TASK instead.
+ *
+ */
+#define START_TASK_3(name, priority, stackDepth) taskParams.push_back({name, priority, stackDepth, std::nullopt, [=, this](){
+/**
+ * @brief Starts the definition of a task. Accepts between one and three
  * parameters. First refers to the name of the task, second refers to its
- * priority.
+ * priority, and third to its stack depth in words. TaskStats::logStackDepths
+ * suggests the depth to give each task once they have all ran for a while on
+ * the brain.
  *
  */
 #define START_TASK(...)                                                        \
-  GET_MACRO(__VA_ARGS__, START_TASK_2, START_TASK_1)(__VA_ARGS__)
+  GET_MACRO_3(__VA_ARGS__, START_TASK_3, START_TASK_2, START_TASK_1)           \
+  (__VA_ARGS__)
+
+/**
+ * @brief Start the definition of a periodic task with its name and period. Do
+ * not use explicitly, use START_PERIODIC_TASK instead.
+ *
+ */
+#define START_PERIODIC_TASK_2(name, period) taskParams.push_back({name, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, period, [=, this](){
+/**
+ * @brief Start the definition of a periodic task with its name, period, and
+ * priority. Do not use explicitly, use START_PERIODIC_TASK instead.
+ *
+ */
+#define START_PERIODIC_TASK_3(name, period, priority) taskParams.push_back({name, priority, TASK_STACK_DEPTH_DEFAULT, period, [=, this](){
+/**
+ * @brief Starts the definition of a periodic task. Accepts between two and
+ * three parameters. First refers to the name of the task, second to its period,
+ * and third to its priority. The body is a single iteration rather than a
+ * loop, and is ran once every period by the Executor. It must not block.
+ *
+ */
+#define START_PERIODIC_TASK(...)                                               \
+  GET_MACRO_3(__VA_ARGS__, START_PERIODIC_TASK_3, START_PERIODIC_TASK_2)       \
+  (__VA_ARGS__)
 
 /**
  * @brief Ends a task definition.
@@ -75,8 +109,12 @@ namespace atum {
  * control their management. To use, publicly derive on the desired class and
  * use the TASK_BOILERPLATE macro. Then, in the cpp file for the class, begin
  * task definitions with "TASK_DEFINITIONS_FOR(<name of the class>) {",
- * "START_TASK(<name>, <priority (optional>))" to begin defining a task, and
- * "END_TASK" to cap the task definition.
+ * "START_TASK(<name>, <priority (optional)>, <stack depth (optional)>)" to
+ * begin defining a task, and
+ * "END_TASK" to cap the task definition. Loops that only run once every fixed
+ * period without blocking should instead use
+ * "START_PERIODIC_TASK(<name>, <period>, <priority (optional)>)" with the body
+ * of a single iteration, which shares a worker task through the Executor.
  *
  * Essentially, this allows classes like "Flywheel" to have background loops for
  * things like velocity control.
@@ -103,12 +141,13 @@ class Task {
       handlerName{handler->getHandlerName()},
       taskLogger{loggerLevel} {
     handler->prepBackgroundTasks();
-    taskLogger.debug("Tasks associated with " + handlerName +
+    LOG_DEBUG(taskLogger, "Tasks associated with " + handlerName +
                      " have been prepared to start.");
   }
 
   /**
-   * @brief Start the background tasks if they haven't already started.
+   * @brief Start the background tasks if they haven't already started. The
+   * timing of every task is recorded, see TaskStats.
    *
    */
   void startBackgroundTasks();
@@ -127,6 +166,9 @@ class Task {
   struct TaskParams {
     const std::string name;
     const std::uint32_t priority;
+    // In words. Periodic tasks run on their Executor worker's stack instead.
+    const std::uint16_t stackDepth;
+    const std::optional<second_t> period; // Only set for periodic tasks.
     const std::function<void()> taskFn;
   };
 
@@ -135,6 +177,9 @@ class Task {
 
   private:
   std::vector<std::unique_ptr<pros::Task>> tasks;
+  std::vector<Executor::Handle> periodicTasks;
+  // Kept across restarts so the stats cover the whole run.
+  std::vector<std::unique_ptr<TaskStats>> taskStats;
   Logger taskLogger; // Named differently than normal for simple disambiguation.
 };
 } // namespace atum
\ No newline at end of file
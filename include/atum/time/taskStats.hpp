@@ -0,0 +1,258 @@
+/**
+ * @file taskStats.hpp
+ * @brief Includes the TaskStats class.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../utility/logger.hpp"
+#include "time.hpp"
+#include <atomic>
+
+namespace pros {
+namespace c {
+extern "C" {
+/**
+ * @brief Gets the least amount of stack, in words, the task has ever had
+ * free. Provided by the PROS kernel but not declared in its public headers.
+ *
+ * @param task
+ * @return std::uint32_t
+ */
+std::uint32_t task_get_stack_high_water_mark(task_t task);
+}
+} // namespace c
+} // namespace pros
+
+namespace atum {
+/**
+ * @brief This class records the timing of a task's iterations: how late each
+ * started (jitter), how long each ran, how many missed their deadline, and how
+ * close the task has come to overflowing its stack.
+ *
+ * An iteration misses its deadline if it finishes more than one period after
+ * it should have started. For periodic tasks that period is the one they were
+ * registered with. For regular tasks, an iteration is the work between two
+ * calls to wait, and its period is the delay last waited for.
+ *
+ * Every task started through the Task class has its stats recorded, which can
+ * be looked up by the task's name at runtime or all logged at once. Recording
+ * does not allocate, except to warn once when a task comes close to
+ * overflowing its stack.
+ *
+ */
+class TaskStats {
+  public:
+  /**
+   * @brief Constructs new TaskStats and registers them to be found by name.
+   * Does nothing more than record if the registry is full.
+   *
+   * @param iName
+   */
+  explicit TaskStats(const std::string &iName);
+
+  /**
+   * @brief Removes the stats from the registry.
+   *
+   */
+  ~TaskStats();
+
+  TaskStats(const TaskStats &) = delete;
+  TaskStats &operator=(const TaskStats &) = delete;
+
+  /**
+   * @brief Associates the stats with the calling task, so each call to wait it
+   * makes ends an iteration and begins the next.
+   *
+   */
+  void attach();
+
+  /**
+   * @brief Marks the start of an iteration. Should be called by the task
+   * being measured.
+   *
+   * @param expectedUs When the iteration should have started.
+   * @param periodUs How long the iteration has to finish, with 0 meaning it
+   * has no deadline.
+   */
+  void begin(const std::uint64_t expectedUs, const std::uint64_t periodUs);
+
+  /**
+   * @brief Marks the end of an iteration. Should be called by the task being
+   * measured.
+   *
+   */
+  void end();
+
+  /**
+   * @brief Gets the name of the task.
+   *
+   * @return const std::string&
+   */
+  const std::string &getName() const;
+
+  /**
+   * @brief Gets the number of iterations recorded.
+   *
+   * @return std::uint32_t
+   */
+  std::uint32_t getIterations() const;
+
+  /**
+   * @brief Gets the number of iterations that missed their deadline.
+   *
+   * @return std::uint32_t
+   */
+  std::uint32_t getMissedDeadlines() const;
+
+  /**
+   * @brief Gets the shortest time an iteration took to run.
+   *
+   * @return second_t
+   */
+  second_t getMinExecution() const;
+
+  /**
+   * @brief Gets the average time an iteration took to run.
+   *
+   * @return second_t
+   */
+  second_t getMeanExecution() const;
+
+  /**
+   * @brief Gets the longest time an iteration took to run.
+   *
+   * @return second_t
+   */
+  second_t getMaxExecution() const;
+
+  /**
+   * @brief Gets the time 99% of iterations finished running within, rounded up
+   * to the resolution of the histogram.
+   *
+   * @return second_t
+   */
+  second_t getP99Execution() const;
+
+  /**
+   * @brief Gets the average of how late iterations started.
+   *
+   * @return second_t
+   */
+  second_t getMeanJitter() const;
+
+  /**
+   * @brief Gets how late the latest iteration to start was.
+   *
+   * @return second_t
+   */
+  second_t getMaxJitter() const;
+
+  /**
+   * @brief Gets the least amount of stack, in bytes, the task has had free.
+   *
+   * @return std::size_t
+   */
+  std::size_t getStackHighWaterMark() const;
+
+  /**
+   * @brief Sets the size of the task's stack, in words, so its peak use can be
+   * worked out. Left unset for tasks that share a stack, like periodic tasks.
+   *
+   * @param iStackDepth
+   */
+  void setStackDepth(const std::uint32_t iStackDepth);
+
+  /**
+   * @brief Gets the most stack, in bytes, the task has used, or 0 if its stack
+   * depth is unknown or it hasn't been measured yet.
+   *
+   * @return std::size_t
+   */
+  std::size_t getPeakStackUse() const;
+
+  /**
+   * @brief Gets the smallest stack depth, in words, that still leaves the task
+   * a safe margin over the most it has used, or 0 if that is unknown. Always 0
+   * in the simulator, which only sees how deep the stack is where the task
+   * blocks, so its peaks are lower bounds rather than depths to use.
+   *
+   * @return std::uint32_t
+   */
+  std::uint32_t getSuggestedStackDepth() const;
+
+  /**
+   * @brief Summarizes the stats in a single line.
+   *
+   * @return std::string
+   */
+  std::string toString() const;
+
+  /**
+   * @brief Finds the stats for the task with the given name.
+   *
+   * @param name
+   * @return const TaskStats* nullptr if there is no such task.
+   */
+  static const TaskStats *find(const std::string &name);
+
+  /**
+   * @brief Finds the stats attached to the calling task.
+   *
+   * @return TaskStats* nullptr if there is no such task.
+   */
+  static TaskStats *current();
+
+  /**
+   * @brief Logs the stats of every task at the info level, which also writes
+   * them to the SD card.
+   *
+   */
+  static void logAll();
+
+  /**
+   * @brief Logs the peak stack use and suggested stack depth of every task with
+   * its own stack at the info level. Best ran on the brain after a full match,
+   * so every task has reached its deepest point. The simulator logs only the
+   * peaks, labelled as lower bounds.
+   *
+   */
+  static void logStackDepths();
+
+  private:
+  static constexpr std::size_t maxTasks{32};
+  static constexpr std::uint32_t binUs{100};
+  static constexpr std::size_t bins{64}; // The last catches everything longer.
+  static constexpr std::uint32_t stackSamplePeriod{64}; // In iterations.
+  // In words. Suggestions are half again the peak plus this, since the high
+  // water mark only covers the paths the task has taken so far, not rarer ones
+  // such as error handling.
+  static constexpr std::uint32_t stackMargin{256};
+  static constexpr std::uint32_t stackWarning{64}; // In words free.
+
+  static std::array<std::atomic<TaskStats *>, maxTasks> registry;
+  static std::atomic<std::size_t> registered;
+
+  const std::string name;
+  std::atomic<pros::task_t> task{nullptr};
+  std::uint64_t startUs{0};
+  std::uint64_t deadlineUs{0};
+  bool running{false};
+
+  std::uint32_t iterations{0};
+  std::uint32_t missedDeadlines{0};
+  std::uint32_t minExecutionUs{std::numeric_limits<std::uint32_t>::max()};
+  std::uint32_t maxExecutionUs{0};
+  std::uint64_t totalExecutionUs{0};
+  std::uint32_t maxJitterUs{0};
+  std::uint64_t totalJitterUs{0};
+  std::uint32_t stackHighWaterMark{std::numeric_limits<std::uint32_t>::max()};
+  std::uint32_t stackDepth{0};
+  bool stackWarned{false};
+  std::array<std::uint32_t, bins> histogram{};
+};
+} // namespace atum
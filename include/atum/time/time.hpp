@@ -48,6 +48,15 @@ static constexpr hour_t forever{infinite};
  */
 second_t time();
 
+/**
+ * @brief Gets the current time since starting with microsecond resolution.
+ * Should be used wherever time differences are divided by, such as in
+ * derivatives, where the millisecond resolution of time would add noise.
+ *
+ * @return second_t
+ */
+second_t preciseTime();
+
 /**
  * @brief Waits for the specified amount of time (or standard delay of 10 ms if
  * no such time is given).
@@ -56,6 +65,15 @@ second_t time();
  */
 void wait(second_t delay = standardDelay);
 
+/**
+ * @brief Waits until the calling task is notified or the timeout is reached.
+ *
+ * @param timeout
+ * @return true The task was notified.
+ * @return false The timeout was reached.
+ */
+bool waitForNotification(const second_t timeout = forever);
+
 /**
  * @brief Waits until the condition given is true or the timeout is reached
  * (unless forever is provided for the timeout). The delay parameter refers to
@@ -72,7 +72,7 @@ class Timer {
 
   /**
    * @brief Gets the time that has passed since getDT was last called (or timer
-   * was created).
+   * was created), to the microsecond.
    *
    * @return second_t
    */
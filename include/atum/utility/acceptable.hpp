@@ -56,7 +56,7 @@ class Acceptable {
       maxDeriv{iMaxDeriv},
       minTimer{minTime},
       logger{loggerLevel} {
-    logger.debug("Acceptable checker has been constructed!");
+    LOG_DEBUG(logger, "Acceptable checker has been constructed!");
   }
 
   /**
@@ -82,7 +82,7 @@ class Acceptable {
     if(!timeoutTimer) {
       timeoutTimer = Timer{timeout};
     }
-    const second_t currentTime{time()};
+    const second_t currentTime{preciseTime()};
     const UnitsPerSecond deriv{(error - prevError) / (currentTime - prevTime)};
     accepted = abs(error) <= maxError;
     accepted = accepted && abs(deriv) <= maxDeriv;
@@ -106,7 +106,7 @@ class Acceptable {
    */
   bool canAccept() {
     if(accepted) {
-      logger.debug("Acceptable object can accept these results.");
+      LOG_DEBUG(logger, "Acceptable object can accept these results.");
     }
     return accepted;
   }
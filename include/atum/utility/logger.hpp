@@ -12,6 +12,7 @@
 #include "../../pros/rtos.hpp"
 #include "../gui/log.hpp"
 #include "../gui/manager.hpp"
+#include "ringBuffer.hpp"
 #include <algorithm>
 #include <fstream>
 #include <iomanip>
@@ -19,6 +20,62 @@
 #include <mutex>
 #include <vector>
 
+/**
+ * @brief The most verbose level, as a number (see Logger::Level), that log
+ * macros are compiled in for. Calls to more verbose macros are compiled out
+ * entirely. Defaults to keeping everything, and can be set with
+ * -DATUM_LOG_LEVEL=3 to compile out every debug call, for instance.
+ *
+ */
+#ifndef ATUM_LOG_LEVEL
+#define ATUM_LOG_LEVEL 4
+#endif
+
+/**
+ * @brief Logs with the given level, but only evaluates the message if the
+ * logger would log it. Do not use explicitly, use the LOG_ macros instead.
+ *
+ */
+#define LOG_AT(level, method, logger, ...)                                     \
+  do {                                                                         \
+    if constexpr(static_cast<int>(atum::Logger::Level::level) <=             \
+                 ATUM_LOG_LEVEL) {                                             \
+      if((logger).getLevel() >= atum::Logger::Level::level) {                  \
+        (logger).method(__VA_ARGS__);                                          \
+      }                                                                        \
+    }                                                                          \
+  } while(false)
+
+/**
+ * @brief Logs a debug message, where the message is only built if the logger
+ * is at the debug level. Compiled out unless ATUM_LOG_LEVEL is 4. Should be
+ * used over Logger::debug wherever building the message costs anything.
+ *
+ */
+#define LOG_DEBUG(logger, ...) LOG_AT(Debug, debug, logger, __VA_ARGS__)
+
+/**
+ * @brief Logs an info message, where the message is only built if the logger
+ * is at the info level or higher.
+ *
+ */
+#define LOG_INFO(logger, ...) LOG_AT(Info, info, logger, __VA_ARGS__)
+
+/**
+ * @brief Logs a warning, where the message is only built if the logger is at
+ * the warn level or higher.
+ *
+ */
+#define LOG_WARN(logger, ...) LOG_AT(Warn, warn, logger, __VA_ARGS__)
+
+/**
+ * @brief Logs an error, where the message is only built if the logger is at
+ * the error level or higher. Unlike Logger::error, an error that isn't logged
+ * doesn't trigger the error screen.
+ *
+ */
+#define LOG_ERROR(logger, ...) LOG_AT(Error, error, logger, __VA_ARGS__)
+
 namespace atum {
 
 /**
@@ -27,6 +84,12 @@ namespace atum {
  * is initialized with the "Info" level, for instance, info, warn, and error
  * messages will be logged.
  *
+ * Logging only copies the message into a preallocated buffer and returns, so
+ * it is safe to do from control loops. A low priority task writes the buffer
+ * out in batches, keeping the log file open between them. Messages logged
+ * while the buffer is full are dropped and counted, and the count is written
+ * out with the next batch.
+ *
  */
 class Logger {
   public:
@@ -79,9 +142,24 @@ class Logger {
    */
   Level getLevel() const;
 
+  /**
+   * @brief Writes out every message still waiting in the buffer from the
+   * calling task, such as before the program ends.
+   *
+   */
+  static void flush();
+
+  /**
+   * @brief Gets the number of messages dropped so far because the buffer was
+   * full.
+   *
+   * @return std::uint32_t
+   */
+  static std::uint32_t getDropped();
+
   private:
   // Allow Logger to use writeTo.
-  friend void GUI::Log::write(const std::string &msg);
+  friend void GUI::Log::write(std::string_view msg);
 
   /**
    * @brief Adds prefix to the message, and outputs to the terminal, file, and
@@ -90,25 +168,94 @@ class Logger {
    * @param prefix
    * @param msg
    * @param msgLevel
+   * @param repeats How many times the message was suppressed since it was
+   * last logged, which is noted after it if any.
    */
-  void log(const std::string &prefix, const std::string &msg, Level msgLevel);
+  void log(const std::string &prefix,
+           const std::string &msg,
+           Level msgLevel,
+           const std::uint32_t repeats = 0);
 
   /**
-   * @brief Checks if the message has already been printed.
+   * @brief Checks if the message has already been logged recently. Repeats
+   * are counted and suppressed until the repeat window has passed since the
+   * message was last logged, at which point it is logged again with the count.
+   *
+   * Messages are remembered by their hash in a small table, so checking takes
+   * the same time and memory however many messages have been logged. When the
+   * table is full, the least recently seen message is forgotten, first logging
+   * the start of it with its count if it has been suppressed since. Messages
+   * the logger's level wouldn't print are suppressed without taking a place in
+   * the table.
    *
    * @param msg
-   * @return true
-   * @return false
+   * @param msgLevel
+   * @param repeats Set to how many times the message was suppressed since it
+   * was last logged, if it should be logged now.
+   * @return true The message should be suppressed.
+   * @return false The message should be logged.
+   */
+  bool alreadyLogged(const std::string &msg,
+                     const Level msgLevel,
+                     std::uint32_t &repeats);
+
+  /**
+   * @brief Gets the prefix messages of the given level are logged with.
+   *
+   * @param msgLevel
+   * @return const char*
+   */
+  static const char *prefixOf(const Level msgLevel);
+
+  /**
+   * @brief Starts the task that writes out the buffer, if it hasn't already.
+   *
+   */
+  static void startFlushing();
+
+  static constexpr std::size_t maxMessageLength{256}; // Longer are cut off.
+  static constexpr std::size_t bufferedMessages{64};
+  static constexpr std::uint32_t flushPeriod{20}; // In milliseconds.
+  static constexpr std::size_t seenMessages{16};
+  static constexpr std::size_t seenExcerptLength{64};
+  static constexpr std::uint32_t repeatWindow{10000}; // In milliseconds.
+
+  /**
+   * @brief A formatted message waiting to be written out.
+   *
+   */
+  struct Entry {
+    Level level;
+    std::array<char, maxMessageLength> text;
+  };
+
+  /**
+   * @brief A message that has been logged recently.
+   *
    */
-  bool alreadyLogged(const std::string &msg);
+  struct Seen {
+    std::size_t hash{0};
+    std::uint32_t loggedAt{0}; // In milliseconds.
+    std::uint32_t seenAt{0};   // In calls to alreadyLogged, for eviction.
+    std::uint32_t repeats{0};
+    Level level{Level::Off};
+    bool used{false};
+    // The start of the message, to report its repeats if it is forgotten.
+    std::array<char, seenExcerptLength> excerpt{};
+  };
 
   static const std::string logFilename;
-  static bool beganLogging;
-  static pros::Mutex logMutex;
+  static RingBuffer<Entry, bufferedMessages> buffer;
+  static std::atomic<bool> flushing;
+  static std::atomic<std::uint32_t> dropped;
+  static std::uint32_t reportedDropped; // Only used while flushing.
+  static std::ofstream file;
+  static pros::Mutex flushMutex;
 
   Level level;
 
-  std::vector<std::string> logs;
+  std::array<Seen, seenMessages> seen{};
+  std::uint32_t checks{0};
 };
 
 } // namespace atum
\ No newline at end of file
@@ -0,0 +1,252 @@
+/**
+ * @file metrics.hpp
+ * @brief Includes the Metrics class, along with the counters, gauges, and
+ * histograms it keeps track of.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "telemetry.hpp"
+#include "units.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace atum {
+/**
+ * @brief This class keeps a registry of metrics counting what the robot's
+ * subsystems have done, such as how many jams the intake has cleared, which
+ * can all be read at once with snapshot. They are shown on the stats screen of
+ * the GUI, and can be recorded to telemetry.
+ *
+ * Metrics register themselves when constructed, and should be static members
+ * or otherwise live for the whole program. Updating one is a single atomic
+ * operation, so they can be updated from any task without locking.
+ *
+ */
+class Metrics {
+  public:
+  /**
+   * @brief The types of metrics.
+   *
+   */
+  enum class Kind { Counter, Gauge, Histogram };
+
+  static constexpr std::size_t maxBounds{Telemetry::maxFields - 1};
+
+  /**
+   * @brief The value of a metric when a snapshot was taken. For histograms,
+   * the value is the number of samples, and each bucket counts the samples
+   * at or below its bound and above the previous, with a last bucket for
+   * those above every bound.
+   *
+   */
+  struct Reading {
+    std::string name;
+    Kind kind;
+    double value;
+    std::vector<double> bounds;
+    std::vector<std::uint32_t> buckets;
+  };
+
+  /**
+   * @brief The parent of every metric, which registers it and its telemetry
+   * channel.
+   *
+   */
+  class Metric {
+    public:
+    Metric(const Metric &) = delete;
+    Metric &operator=(const Metric &) = delete;
+
+    /**
+     * @brief Gets the name of the metric.
+     *
+     * @return const std::string&
+     */
+    const std::string &getName() const;
+
+    /**
+     * @brief Reads the current value of the metric.
+     *
+     * @return Reading
+     */
+    virtual Reading read() const = 0;
+
+    /**
+     * @brief Records the current value of the metric to telemetry.
+     *
+     */
+    virtual void record() const = 0;
+
+    protected:
+    /**
+     * @brief Registers the metric, with a telemetry channel of the same name
+     * with the given fields.
+     *
+     * @param iName
+     * @param fields
+     */
+    Metric(const std::string &iName, const std::vector<std::string> &fields);
+
+    const std::string name;
+    const Telemetry::Channel channel;
+  };
+
+  /**
+   * @brief A count of how many times something has happened.
+   *
+   */
+  class Counter : public Metric {
+    public:
+    /**
+     * @brief Constructs and registers a new Counter starting at zero.
+     *
+     * @param iName
+     */
+    Counter(const std::string &iName);
+
+    /**
+     * @brief Adds to the count.
+     *
+     * @param amount
+     */
+    void add(const std::uint32_t amount = 1);
+
+    /**
+     * @brief Gets the count.
+     *
+     * @return std::uint32_t
+     */
+    std::uint32_t get() const;
+
+    Reading read() const override;
+    void record() const override;
+
+    private:
+    std::atomic<std::uint32_t> count{0};
+  };
+
+  /**
+   * @brief The latest value of some measurement.
+   *
+   */
+  class Gauge : public Metric {
+    public:
+    /**
+     * @brief Constructs and registers a new Gauge starting at zero.
+     *
+     * @param iName
+     */
+    Gauge(const std::string &iName);
+
+    /**
+     * @brief Sets the value.
+     *
+     * @param iValue
+     */
+    void set(const double iValue);
+
+    /**
+     * @brief Gets the value.
+     *
+     * @return double
+     */
+    double get() const;
+
+    Reading read() const override;
+    void record() const override;
+
+    private:
+    std::atomic<float> value{0.0f};
+  };
+
+  /**
+   * @brief Counts samples of some measurement in buckets with fixed bounds.
+   *
+   */
+  class Histogram : public Metric {
+    public:
+    /**
+     * @brief Constructs and registers a new Histogram with the given upper
+     * bounds of its buckets, in increasing order. Any bounds past maxBounds
+     * are ignored.
+     *
+     * @param iName
+     * @param iBounds
+     */
+    Histogram(const std::string &iName,
+              const std::initializer_list<double> iBounds);
+
+    /**
+     * @brief Adds a sample to the bucket it falls in.
+     *
+     * @param sample
+     */
+    void add(const double sample);
+
+    Reading read() const override;
+    void record() const override;
+
+    private:
+    /**
+     * @brief Names the telemetry fields after the bounds of the buckets.
+     *
+     * @param bounds
+     * @return std::vector<std::string>
+     */
+    static std::vector<std::string>
+        bucketFields(const std::initializer_list<double> bounds);
+
+    std::array<double, maxBounds> bounds{};
+    std::size_t boundCount{0};
+    std::array<std::atomic<std::uint32_t>, maxBounds + 1> buckets{};
+  };
+
+  /**
+   * @brief Reads every registered metric at once, in order of registration.
+   * Allocates, so should only be called every so often.
+   *
+   * @return std::vector<Reading>
+   */
+  static std::vector<Reading> snapshot();
+
+  /**
+   * @brief Formats a reading as a line of text, such as "intake jams: 3".
+   *
+   * @param reading
+   * @return std::string
+   */
+  static std::string toString(const Reading &reading);
+
+  /**
+   * @brief Records every registered metric to telemetry, if recording.
+   *
+   */
+  static void record();
+
+  /**
+   * @brief Starts recording every registered metric to telemetry with the
+   * given period, while telemetry is recording.
+   *
+   * @param period
+   */
+  static void startRecording(const second_t period = 500_ms);
+
+  private:
+  /**
+   * @brief Gets the registered metrics. A function local static, so metrics
+   * can be registered during static initialization from any file.
+   *
+   * @return std::vector<Metric *>&
+   */
+  static std::vector<Metric *> &getMetrics();
+};
+} // namespace atum
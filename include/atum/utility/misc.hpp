@@ -23,6 +23,13 @@ namespace atum {
  */
 #define GET_MACRO(_1, _2, NAME, ...) NAME
 
+/**
+ * @brief The same as GET_MACRO, but for up to three parameters. Do not use
+ * explicity.
+ *
+ */
+#define GET_MACRO_3(_1, _2, _3, NAME, ...) NAME
+
 /**
  * @brief Provided for disambiguation purposes in a few constructors.
  *
@@ -0,0 +1,160 @@
+/**
+ * @file ringBuffer.hpp
+ * @brief Includes the RingBuffer template class.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace atum {
+/**
+ * @brief This class template is a fixed-capacity queue that any number of
+ * tasks can push to and pop from at once without locking. Every slot is
+ * constructed up front, so it never allocates after construction (though the
+ * values moved in and out still may).
+ *
+ * Each slot carries a sequence number saying whether it is ready to be written
+ * or read for a given position. Pushing and popping claim a position with a
+ * compare and swap and then publish the slot, so a task interrupted halfway
+ * through holds up only the slot it claimed. Popping that slot reports the
+ * queue as empty until it is published instead of waiting on it.
+ *
+ * @tparam T
+ * @tparam Capacity Must be a power of two.
+ */
+template <typename T, std::size_t Capacity>
+class RingBuffer {
+  static_assert(Capacity && !(Capacity & (Capacity - 1)),
+                "Ring buffer capacity must be a power of two.");
+
+  public:
+  /**
+   * @brief Constructs a new, empty ring buffer.
+   *
+   */
+  RingBuffer() {
+    for(std::size_t i{0}; i < Capacity; i++) {
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  RingBuffer(const RingBuffer &) = delete;
+  RingBuffer &operator=(const RingBuffer &) = delete;
+
+  /**
+   * @brief Adds the value to the back of the queue, unless it is full.
+   *
+   * @param value
+   * @return true The value was added.
+   * @return false The queue was full.
+   */
+  bool push(T value) {
+    std::size_t position{tail.load(std::memory_order_relaxed)};
+    Slot *slot;
+    while(true) {
+      slot = &slots[position & mask];
+      const std::size_t sequence{slot->sequence.load(std::memory_order_acquire)};
+      const std::intptr_t difference{static_cast<std::intptr_t>(sequence) -
+                                     static_cast<std::intptr_t>(position)};
+      if(difference == 0) {
+        if(tail.compare_exchange_weak(
+               position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if(difference < 0) {
+        return false;
+      } else {
+        position = tail.load(std::memory_order_relaxed);
+      }
+    }
+    slot->value = std::move(value);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Moves the value at the front of the queue into the given value,
+   * unless it is empty.
+   *
+   * @param value
+   * @return true A value was removed.
+   * @return false The queue was empty.
+   */
+  bool pop(T &value) {
+    std::size_t position{head.load(std::memory_order_relaxed)};
+    Slot *slot;
+    while(true) {
+      slot = &slots[position & mask];
+      const std::size_t sequence{slot->sequence.load(std::memory_order_acquire)};
+      const std::intptr_t difference{static_cast<std::intptr_t>(sequence) -
+                                     static_cast<std::intptr_t>(position + 1)};
+      if(difference == 0) {
+        if(head.compare_exchange_weak(
+               position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if(difference < 0) {
+        return false;
+      } else {
+        position = head.load(std::memory_order_relaxed);
+      }
+    }
+    value = std::move(slot->value);
+    slot->sequence.store(position + Capacity, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Gets the number of values in the queue. Only approximate while
+   * other tasks are pushing or popping.
+   *
+   * @return std::size_t
+   */
+  std::size_t size() const {
+    const std::size_t back{tail.load(std::memory_order_acquire)};
+    const std::size_t front{head.load(std::memory_order_acquire)};
+    return back > front ? back - front : 0;
+  }
+
+  /**
+   * @brief Says if the queue is empty. Only approximate while other tasks are
+   * pushing or popping.
+   *
+   * @return true
+   * @return false
+   */
+  bool empty() const {
+    return !size();
+  }
+
+  /**
+   * @brief Gets the most values the queue can hold.
+   *
+   * @return std::size_t
+   */
+  static constexpr std::size_t capacity() {
+    return Capacity;
+  }
+
+  private:
+  static constexpr std::size_t mask{Capacity - 1};
+
+  struct Slot {
+    std::atomic<std::size_t> sequence;
+    T value{};
+  };
+
+  std::array<Slot, Capacity> slots;
+  std::atomic<std::size_t> head{0};
+  std::atomic<std::size_t> tail{0};
+};
+} // namespace atum
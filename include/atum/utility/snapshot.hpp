@@ -0,0 +1,115 @@
+/**
+ * @file snapshot.hpp
+ * @brief Includes the Snapshot template class.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace atum {
+/**
+ * @brief This class template holds the latest value written by one task so
+ * any number of other tasks can read it without locking and without ever
+ * seeing a half-written value.
+ *
+ * There are two slots. The writer fills whichever one readers aren't pointed
+ * at, then points readers at it. Each slot has a sequence number that is odd
+ * while the slot is being written, so a reader that is interrupted long enough
+ * for the writer to come back around to its slot notices and reads again.
+ * Neither side ever waits on the other.
+ *
+ * Only one task may store at a time; callers with several writers must
+ * serialize them.
+ *
+ * @tparam T
+ */
+template <typename T>
+class Snapshot {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Snapshot values are copied word by word.");
+
+  public:
+  /**
+   * @brief Constructs a new snapshot holding the given value.
+   *
+   * @param initial
+   */
+  explicit Snapshot(const T &initial = T{}) {
+    write(slots[0], initial);
+  }
+
+  /**
+   * @brief Publishes a new value.
+   *
+   * @param value
+   */
+  void store(const T &value) {
+    const std::size_t next{1 - published.load(std::memory_order_relaxed)};
+    Slot &slot{slots[next]};
+    slot.sequence.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    write(slot, value);
+    slot.sequence.fetch_add(1, std::memory_order_release);
+    published.store(next, std::memory_order_release);
+  }
+
+  /**
+   * @brief Gets the latest value published.
+   *
+   * @return T
+   */
+  T load() const {
+    std::array<std::uint32_t, words> buffer;
+    while(true) {
+      const Slot &slot{slots[published.load(std::memory_order_acquire)]};
+      const std::uint32_t before{slot.sequence.load(std::memory_order_acquire)};
+      if(before % 2) {
+        continue;
+      }
+      for(std::size_t i{0}; i < words; i++) {
+        buffer[i] = slot.data[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if(slot.sequence.load(std::memory_order_relaxed) == before) {
+        break;
+      }
+    }
+    // Copied out as bytes rather than into a T, which may not be trivial to
+    // construct.
+    std::array<std::byte, sizeof(T)> bytes;
+    std::memcpy(bytes.data(), buffer.data(), sizeof(T));
+    return std::bit_cast<T>(bytes);
+  }
+
+  private:
+  static constexpr std::size_t words{(sizeof(T) + sizeof(std::uint32_t) - 1) /
+                                     sizeof(std::uint32_t)};
+
+  struct Slot {
+    std::atomic<std::uint32_t> sequence{0};
+    std::array<std::atomic<std::uint32_t>, words> data{};
+  };
+
+  static void write(Slot &slot, const T &value) {
+    std::array<std::uint32_t, words> buffer{};
+    std::memcpy(buffer.data(), &value, sizeof(T));
+    for(std::size_t i{0}; i < words; i++) {
+      slot.data[i].store(buffer[i], std::memory_order_relaxed);
+    }
+  }
+
+  std::array<Slot, 2> slots;
+  std::atomic<std::size_t> published{0};
+};
+} // namespace atum
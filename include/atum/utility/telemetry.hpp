@@ -0,0 +1,262 @@
+/**
+ * @file telemetry.hpp
+ * @brief Includes the Telemetry class.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../pros/rtos.hpp"
+#include "ringBuffer.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace atum {
+/**
+ * @brief This class records numbers from the control loops to a compact binary
+ * file for analysis after a run, such as with the decoder in sim/decode.cpp.
+ *
+ * Values are recorded to channels, each with a name and a list of field names.
+ * Channels should be added during static initialization, so that all of them
+ * are described in the file's header when recording starts. Recording only
+ * copies the values into a preallocated buffer and returns, and does nothing
+ * at all unless recording has been started. A low priority task packs the
+ * buffer into fixed-size records and writes them out in large blocks.
+ *
+ * Most channels are recorded as floats, but channels of sensor readings that
+ * need to be replayed exactly (see sim/recording.hpp) can be recorded as
+ * doubles instead, with half as many fields.
+ *
+ * The file starts with a header: the magic string, the number of channels, and
+ * for each channel its id, number of fields, precision, and name and field
+ * names as null-terminated strings. Every record after that is a Record, where
+ * the time is stored as a difference from the previous record's time. A sync
+ * record holding the full time is written first, at the time recording started,
+ * and whenever the difference is too large to store. Everything is written
+ * little-endian, as both the brain and any host are.
+ *
+ */
+class Telemetry {
+  public:
+  using Channel = std::uint8_t;
+
+  /**
+   * @brief How a channel's values are stored.
+   *
+   */
+  enum class Precision : std::uint8_t { Single = 0, Double = 1 };
+
+  static constexpr std::size_t maxFields{8};
+  static constexpr std::size_t maxPreciseFields{maxFields / 2};
+  static constexpr Channel syncChannel{0xFF}; // Not a valid channel.
+  static constexpr char magic[8]{'A', 'T', 'U', 'M', 'T', 'L', 'M', '2'};
+
+  /**
+   * @brief A record as written to the file. Double precision channels store
+   * their values in the bytes of pairs of floats, as do sync records the full
+   * time in microseconds.
+   *
+   */
+  struct Record {
+    Channel channel;
+    std::uint8_t reserved;
+    std::int16_t delta; // In microseconds since the previous record.
+    std::array<float, maxFields> values;
+  };
+
+  static_assert(sizeof(Record) == 4 + 4 * maxFields,
+                "Telemetry records must not be padded.");
+
+  /**
+   * @brief Adds a channel with the given name and field names, returning its
+   * id to record to. Should be called during static initialization, such as
+   * when initializing a constant at namespace scope, since channels added after
+   * recording starts are not recorded until it is started again.
+   *
+   * @param name
+   * @param fields At most maxFields, or maxPreciseFields if double precision.
+   * @param precision
+   * @return Channel
+   */
+  static Channel addChannel(const std::string &name,
+                            const std::vector<std::string> &fields,
+                            const Precision precision = Precision::Single);
+
+  /**
+   * @brief Records the values to the channel, in the order of its fields, if
+   * recording. Never allocates or blocks, so is safe to call from any control
+   * loop. Values recorded while the buffer is full are dropped and counted.
+   *
+   * @tparam Values
+   * @param channel
+   * @param values
+   */
+  template <typename... Values>
+  static void record(const Channel channel, const Values... values) {
+    static_assert(sizeof...(Values) <= maxFields,
+                  "Too many values for one telemetry record.");
+    if(!recording.load(std::memory_order_relaxed)) {
+      return;
+    }
+    push(channel, {static_cast<float>(values)...});
+  }
+
+  /**
+   * @brief Records the values to a double precision channel, like record.
+   *
+   * @tparam Values
+   * @param channel
+   * @param values
+   */
+  template <typename... Values>
+  static void recordPrecise(const Channel channel, const Values... values) {
+    static_assert(sizeof...(Values) <= maxPreciseFields,
+                  "Too many values for one precise telemetry record.");
+    if(!recording.load(std::memory_order_relaxed)) {
+      return;
+    }
+    const std::array<double, maxPreciseFields> precise{
+        static_cast<double>(values)...};
+    std::array<float, maxFields> packed;
+    std::memcpy(packed.data(), precise.data(), sizeof(precise));
+    push(channel, packed);
+  }
+
+  /**
+   * @brief Checks if recording, such as to skip reading values only needed
+   * for telemetry.
+   *
+   * @return true
+   * @return false
+   */
+  static bool isRecording();
+
+  /**
+   * @brief Opens the file, writes the header, and starts recording. If already
+   * recording, stops first.
+   *
+   * @param filename
+   */
+  static void start(const std::string &filename = "telemetry.bin");
+
+  /**
+   * @brief Stops recording, writes out everything recorded, and closes the
+   * file.
+   *
+   */
+  static void stop();
+
+  /**
+   * @brief Writes out everything recorded so far from the calling task,
+   * including a partially filled block.
+   *
+   */
+  static void flush();
+
+  /**
+   * @brief Gets the number of records dropped so far because the buffer was
+   * full.
+   *
+   * @return std::uint32_t
+   */
+  static std::uint32_t getDropped();
+
+  private:
+  /**
+   * @brief A channel's name and field names.
+   *
+   */
+  struct Description {
+    std::string name;
+    std::vector<std::string> fields;
+    Precision precision;
+  };
+
+  /**
+   * @brief Values waiting to be written out, with their full time.
+   *
+   */
+  struct Entry {
+    Channel channel;
+    std::uint64_t time; // In microseconds.
+    std::array<float, maxFields> values;
+  };
+
+  /**
+   * @brief Timestamps the values and adds them to the buffer.
+   *
+   * @param channel
+   * @param values
+   */
+  static void push(const Channel channel,
+                   const std::array<float, maxFields> &values);
+
+  /**
+   * @brief Moves everything in the buffer into the block, writing the block
+   * out whenever it fills. Must hold the file mutex.
+   *
+   */
+  static void drain();
+
+  /**
+   * @brief Adds a sync record with the given time to the block. Must hold the
+   * file mutex.
+   *
+   * @param time In microseconds.
+   */
+  static void writeSync(const std::uint64_t time);
+
+  /**
+   * @brief Adds a record to the block, writing the block out first if it is
+   * full. Must hold the file mutex.
+   *
+   * @param record
+   */
+  static void write(const Record &record);
+
+  /**
+   * @brief Writes out the filled part of the block. Must hold the file mutex.
+   *
+   */
+  static void writeBlock();
+
+  /**
+   * @brief Gets the channels added so far. A function local static, so
+   * channels can be added during static initialization from any file.
+   *
+   * @return std::vector<Description>&
+   */
+  static std::vector<Description> &getDescriptions();
+
+  /**
+   * @brief Starts the task that writes out the buffer, if it hasn't already.
+   *
+   */
+  static void startFlushing();
+
+  static constexpr std::size_t bufferedRecords{512};
+  static constexpr std::size_t blockSize{4096}; // In bytes.
+  static constexpr std::uint32_t flushPeriod{20}; // In milliseconds.
+
+  static RingBuffer<Entry, bufferedRecords> buffer;
+  static std::atomic<bool> recording;
+  static std::atomic<bool> flushing;
+  static std::atomic<Channel> describedChannels;
+  static std::atomic<std::uint32_t> dropped;
+  static std::uint32_t refused; // Channels that could not be added.
+  // Only used while holding the file mutex.
+  static std::ofstream file;
+  static std::array<char, blockSize> block;
+  static std::size_t blockUsed;
+  static std::uint64_t previousTime;
+  static pros::Mutex fileMutex;
+};
+} // namespace atum
@@ -25,6 +25,7 @@ using namespace units::velocity;
 using namespace units::angular_velocity;
 using namespace units::acceleration;
 using namespace units::time;
+using namespace units::frequency;
 
 // Needed for macro to properly disambiguate length, feet, etcetera.
 namespace units {
@@ -202,5 +202,10 @@ class Intake : public Task, public StateMachine<IntakeState> {
   Parameters params;
   ColorSensor::Color sortOutColor{ColorSensor::Color::Red};
   IntakeState returnState{IntakeState::Intaking};
+
+  static const Telemetry::Channel telemetryChannel;
+  static Metrics::Counter jams;
+  static Metrics::Counter sorts;
+  static Metrics::Counter loads;
 };
 } // namespace atum
\ No newline at end of file
@@ -260,5 +260,10 @@ class Ladybrown : public Task, public StateMachine<LadybrownState> {
   std::optional<degree_t> holdPosition;
   bool enableSlew{false};
   double voltage;
+
+  static const Telemetry::Channel telemetryChannel;
+  static Metrics::Counter moves;
+  static Metrics::Counter interruptedMoves;
+  static Metrics::Histogram moveTimes; // Of moves that finished.
 };
 } // namespace atum
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "sim.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Counts every heap allocation so hot paths can be checked for them.
+
+namespace {
+std::atomic<std::uint64_t> allocationCount{0};
+
+void *allocate(const std::size_t size) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  if(void *ptr{std::malloc(size ? size : 1)}) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+} // namespace
+
+namespace atum {
+namespace sim {
+std::uint64_t allocations() {
+  return allocationCount.load(std::memory_order_relaxed);
+}
+} // namespace sim
+} // namespace atum
+
+void *operator new(const std::size_t size) {
+  return allocate(size);
+}
+
+void *operator new[](const std::size_t size) {
+  return allocate(size);
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
@@ -0,0 +1,89 @@
+#include "recording.hpp"
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Decodes a telemetry file recorded by atum::Telemetry into one CSV file per
+// channel, each with a column of times in seconds since recording started
+// followed by a column per field, ready for a spreadsheet or a dataframe
+// library.
+//
+//   ./decode [telemetry.bin] [prefix]
+//
+// Writes <prefix>_<channel>.csv, where the prefix defaults to the input's name
+// without its extension.
+
+using atum::sim::Recording;
+
+namespace {
+// Keeps file names portable, e.g. "profile m" becomes "profile_m".
+std::string sanitize(std::string name) {
+  for(char &c : name) {
+    if(!std::isalnum(static_cast<unsigned char>(c))) {
+      c = '_';
+    }
+  }
+  return name;
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  const std::string input{argc > 1 ? argv[1] : "telemetry.bin"};
+  const std::string prefix{argc > 2 ? argv[2] :
+                                      input.substr(0, input.rfind('.'))};
+  const Recording recording{input};
+  std::string error;
+  if(!recording.isLoaded(&error)) {
+    std::cerr << error << '\n';
+    return 1;
+  }
+  const std::vector<Recording::Channel> &channels{recording.getChannels()};
+  std::vector<std::unique_ptr<std::ofstream>> csvs(channels.size());
+  std::vector<std::size_t> counts(channels.size());
+  for(const Recording::Sample &sample : recording.getSamples()) {
+    const Recording::Channel &channel{channels[sample.channel]};
+    std::unique_ptr<std::ofstream> &csv{csvs[sample.channel]};
+    if(!csv) {
+      csv = std::make_unique<std::ofstream>(prefix + "_" +
+                                            sanitize(channel.name) + ".csv");
+      *csv << "time_s";
+      for(const std::string &field : channel.fields) {
+        *csv << ',' << field;
+      }
+      *csv << '\n';
+    }
+    char line[32];
+    std::snprintf(line,
+                  sizeof(line),
+                  "%.6f",
+                  (sample.time - recording.getStart()) / 1e6);
+    *csv << line;
+    for(std::size_t j{0}; j < channel.fields.size(); j++) {
+      // Enough digits to read back the same value at either precision.
+      std::snprintf(line,
+                    sizeof(line),
+                    channel.precision == atum::Telemetry::Precision::Double ?
+                        ",%.17g" :
+                        ",%.9g",
+                    sample.values[j]);
+      *csv << line;
+    }
+    *csv << '\n';
+    counts[sample.channel]++;
+  }
+
+  for(std::size_t i{0}; i < channels.size(); i++) {
+    if(counts[i]) {
+      std::printf("%-24s %8zu records -> %s_%s.csv\n",
+                  channels[i].name.c_str(),
+                  counts[i],
+                  prefix.c_str(),
+                  sanitize(channels[i].name).c_str());
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,1238 @@
+#include "pros/adi.hpp"
+#include "pros/distance.hpp"
+#include "pros/gps.hpp"
+#include "pros/imu.hpp"
+#include "pros/misc.hpp"
+#include "pros/motors.hpp"
+#include "pros/optical.hpp"
+#include "pros/rotation.hpp"
+#include "pros/rtos.hpp"
+#include "sim.hpp"
+#include <array>
+#include <cmath>
+
+namespace atum {
+namespace sim {
+namespace {
+constexpr std::size_t portCount{32};
+constexpr std::size_t adiPortCount{9};
+
+struct Registry {
+  std::array<pros::DeviceType, portCount> plugged{};
+  std::array<MotorState, portCount> motors{};
+  std::array<IMUState, portCount> imus{};
+  std::array<RotationState, portCount> rotations{};
+  std::array<DistanceState, portCount> distances{};
+  std::array<OpticalState, portCount> opticals{};
+  std::array<GPSState, portCount> gpses{};
+  std::array<std::array<EncoderState, adiPortCount>, portCount> encoders{};
+  std::array<std::array<ADIState, adiPortCount>, portCount> adis{};
+  std::array<ControllerState, 2> controllers{};
+};
+
+Registry &registry() {
+  static Registry *r{new Registry};
+  return *r;
+}
+
+std::size_t clampPort(const std::uint8_t port) {
+  return port < portCount ? port : 0;
+}
+
+// Accepts both the numbered (1-8) and lettered ('a'-'h', 'A'-'H') forms.
+std::uint8_t adiIndex(std::uint8_t adiPort) {
+  if(adiPort >= 'a' && adiPort <= 'h') {
+    adiPort -= 'a' - 1;
+  } else if(adiPort >= 'A' && adiPort <= 'H') {
+    adiPort -= 'A' - 1;
+  }
+  return adiPort < adiPortCount ? adiPort : 0;
+}
+
+double targetVelocity(const MotorState &state) {
+  switch(state.mode) {
+    case MotorState::Mode::Voltage:
+      return state.voltage / 12000.0 * state.maxVelocity;
+    case MotorState::Mode::Velocity:
+      return std::clamp<double>(
+          state.targetVelocity, -state.maxVelocity, state.maxVelocity);
+    default: return 0.0;
+  }
+}
+
+double maxVelocityOf(const pros::MotorGears gearset) {
+  switch(gearset) {
+    case pros::MotorGears::red: return 100.0;
+    case pros::MotorGears::blue: return 600.0;
+    default: return 200.0;
+  }
+}
+
+double ticksPerDegree(const MotorState &state) {
+  switch(state.encoderUnits) {
+    case 1: return 1.0 / 360.0;
+    case 2: return 1800.0 / state.maxVelocity * 100.0 / 360.0;
+    default: return 1.0;
+  }
+}
+
+// The motor's first order response is solved exactly between commands, so it
+// can be brought up to date lazily whenever it is looked at.
+void advance(MotorState &state) {
+  const std::uint64_t nowUs{now()};
+  if(nowUs <= state.updatedUs) {
+    return;
+  }
+  const double dt{(nowUs - state.updatedUs) / 1e6};
+  state.updatedUs = nowUs;
+  const double target{targetVelocity(state)};
+  const double tau{state.mode == MotorState::Mode::Brake &&
+                           state.brakeMode == 0
+                       ? state.timeConstant * 4.0
+                       : state.timeConstant};
+  const double decay{std::exp(-dt / tau)};
+  const double initialError{state.velocity - target};
+  // RPM to degrees per second.
+  state.position += 6.0 * (target * dt + initialError * tau * (1.0 - decay));
+  state.velocity = target + initialError * decay;
+}
+} // namespace
+
+void plug(const std::uint8_t port, const pros::DeviceType type) {
+  registry().plugged[clampPort(port)] = type;
+}
+
+void unplug(const std::uint8_t port) {
+  plug(port, pros::DeviceType::none);
+}
+
+pros::DeviceType pluggedType(const std::uint8_t port) {
+  return registry().plugged[clampPort(port)];
+}
+
+MotorState &motor(const std::uint8_t port) {
+  MotorState &state{registry().motors[clampPort(port)]};
+  advance(state);
+  return state;
+}
+
+IMUState &imu(const std::uint8_t port) {
+  return registry().imus[clampPort(port)];
+}
+
+EncoderState &encoder(const std::uint8_t adiPort, const std::uint8_t smartPort) {
+  return registry().encoders[clampPort(smartPort)][adiIndex(adiPort)];
+}
+
+ADIState &adi(const std::uint8_t adiPort, const std::uint8_t smartPort) {
+  return registry().adis[clampPort(smartPort)][adiIndex(adiPort)];
+}
+
+RotationState &rotation(const std::uint8_t port) {
+  return registry().rotations[clampPort(port)];
+}
+
+DistanceState &distance(const std::uint8_t port) {
+  return registry().distances[clampPort(port)];
+}
+
+OpticalState &optical(const std::uint8_t port) {
+  return registry().opticals[clampPort(port)];
+}
+
+GPSState &gps(const std::uint8_t port) {
+  return registry().gpses[clampPort(port)];
+}
+
+ControllerState &controller(const std::uint8_t id) {
+  return registry().controllers[id ? 1 : 0];
+}
+} // namespace sim
+} // namespace atum
+
+using namespace atum;
+
+namespace pros {
+inline namespace v5 {
+namespace {
+// Plugs a device in on construction unless something else already is.
+void claim(const std::uint8_t port, const DeviceType type) {
+  if(sim::pluggedType(port) == DeviceType::none) {
+    sim::plug(port, type);
+  }
+}
+
+template <typename T>
+std::vector<T> devicesOfType(const DeviceType type) {
+  std::vector<T> devices;
+  for(std::uint8_t port{1}; port <= 21; port++) {
+    if(sim::pluggedType(port) == type) {
+      devices.push_back(T{port});
+    }
+  }
+  return devices;
+}
+} // namespace
+
+Device::Device(const std::uint8_t port) : _port{port} {}
+
+std::uint8_t Device::get_port(void) const {
+  return _port;
+}
+
+bool Device::is_installed() {
+  return sim::pluggedType(_port) == _deviceType;
+}
+
+DeviceType Device::get_plugged_type() const {
+  return sim::pluggedType(_port);
+}
+
+DeviceType Device::get_plugged_type(std::uint8_t port) {
+  return sim::pluggedType(port);
+}
+
+std::vector<Device> Device::get_all_devices(DeviceType device_type) {
+  std::vector<Device> devices;
+  for(std::uint8_t port{1}; port <= 21; port++) {
+    const DeviceType type{sim::pluggedType(port)};
+    if(type != DeviceType::none &&
+       (device_type == DeviceType::undefined || type == device_type)) {
+      devices.push_back(Device{port});
+    }
+  }
+  return devices;
+}
+
+// Motor
+
+Motor::Motor(const std::int8_t port,
+             const MotorGears gearset,
+             const MotorUnits encoder_units) :
+    Device(std::abs(port), DeviceType::motor),
+    _port{port} {
+  claim(Device::_port, DeviceType::motor);
+  if(gearset != MotorGears::invalid) {
+    set_gearing(gearset);
+  }
+  if(encoder_units != MotorUnits::invalid) {
+    set_encoder_units(encoder_units);
+  }
+}
+
+std::vector<Motor> Motor::get_all_devices() {
+  std::vector<Motor> motors;
+  for(std::uint8_t port{1}; port <= 21; port++) {
+    if(sim::pluggedType(port) == DeviceType::motor) {
+      motors.push_back(Motor{static_cast<std::int8_t>(port)});
+    }
+  }
+  return motors;
+}
+
+namespace {
+double direction(const std::int8_t port) {
+  return port < 0 ? -1.0 : 1.0;
+}
+
+template <typename T>
+std::vector<T> all(const T value) {
+  return std::vector<T>{value};
+}
+} // namespace
+
+std::int32_t Motor::move(std::int32_t voltage) const {
+  return move_voltage(std::clamp(voltage, -127, 127) * 12000 / 127);
+}
+
+std::int32_t Motor::move_absolute(const double position,
+                                  const std::int32_t velocity) const {
+  sim::MotorState &state{sim::motor(Device::_port)};
+  const double error{direction(_port) * position / sim::ticksPerDegree(state) -
+                     state.position};
+  state.mode = sim::MotorState::Mode::Velocity;
+  state.targetVelocity = std::copysign(std::abs(velocity), error);
+  return 1;
+}
+
+std::int32_t Motor::move_relative(const double position,
+                                  const std::int32_t velocity) const {
+  return move_absolute(get_position() + position, velocity);
+}
+
+std::int32_t Motor::move_velocity(const std::int32_t velocity) const {
+  sim::MotorState &state{sim::motor(Device::_port)};
+  state.mode = sim::MotorState::Mode::Velocity;
+  state.targetVelocity = direction(_port) * velocity;
+  return 1;
+}
+
+std::int32_t Motor::move_voltage(const std::int32_t voltage) const {
+  sim::MotorState &state{sim::motor(Device::_port)};
+  state.mode = sim::MotorState::Mode::Voltage;
+  state.voltage = direction(_port) * std::clamp(voltage, -12000, 12000);
+  return 1;
+}
+
+std::int32_t Motor::brake(void) const {
+  sim::motor(Device::_port).mode = sim::MotorState::Mode::Brake;
+  return 1;
+}
+
+std::int32_t Motor::modify_profiled_velocity(const std::int32_t velocity) const {
+  return move_velocity(velocity);
+}
+
+double Motor::get_target_position(const std::uint8_t) const {
+  return get_position();
+}
+
+std::vector<double> Motor::get_target_position_all(void) const {
+  return all(get_target_position());
+}
+
+std::int32_t Motor::get_target_velocity(const std::uint8_t) const {
+  return direction(_port) * sim::motor(Device::_port).targetVelocity;
+}
+
+std::vector<std::int32_t> Motor::get_target_velocity_all(void) const {
+  return all(get_target_velocity());
+}
+
+double Motor::get_actual_velocity(const std::uint8_t) const {
+  return direction(_port) * sim::motor(Device::_port).velocity;
+}
+
+std::vector<double> Motor::get_actual_velocity_all(void) const {
+  return all(get_actual_velocity());
+}
+
+std::int32_t Motor::get_current_draw(const std::uint8_t) const {
+  const sim::MotorState &state{sim::motor(Device::_port)};
+  const double target{sim::targetVelocity(state)};
+  return std::min<double>(state.currentLimit,
+                          std::abs(target - state.velocity) /
+                              state.maxVelocity * state.currentLimit);
+}
+
+std::vector<std::int32_t> Motor::get_current_draw_all(void) const {
+  return all(get_current_draw());
+}
+
+std::int32_t Motor::get_direction(const std::uint8_t) const {
+  return get_actual_velocity() < 0 ? -1 : 1;
+}
+
+std::vector<std::int32_t> Motor::get_direction_all(void) const {
+  return all(get_direction());
+}
+
+double Motor::get_efficiency(const std::uint8_t) const {
+  return 100.0;
+}
+
+std::vector<double> Motor::get_efficiency_all(void) const {
+  return all(get_efficiency());
+}
+
+std::uint32_t Motor::get_faults(const std::uint8_t) const {
+  return 0;
+}
+
+std::vector<std::uint32_t> Motor::get_faults_all(void) const {
+  return all(get_faults());
+}
+
+std::uint32_t Motor::get_flags(const std::uint8_t) const {
+  return 0;
+}
+
+std::vector<std::uint32_t> Motor::get_flags_all(void) const {
+  return all(get_flags());
+}
+
+double Motor::get_position(const std::uint8_t) const {
+  const sim::MotorState &state{sim::motor(Device::_port)};
+  return direction(_port) * state.position * sim::ticksPerDegree(state);
+}
+
+std::vector<double> Motor::get_position_all(void) const {
+  return all(get_position());
+}
+
+double Motor::get_power(const std::uint8_t) const {
+  return get_voltage() / 1000.0 * get_current_draw() / 1000.0;
+}
+
+std::vector<double> Motor::get_power_all(void) const {
+  return all(get_power());
+}
+
+std::int32_t Motor::get_raw_position(std::uint32_t *const timestamp,
+                                     const std::uint8_t) const {
+  if(timestamp) {
+    *timestamp = c::millis();
+  }
+  const sim::MotorState &state{sim::motor(Device::_port)};
+  return direction(_port) * state.position * 1800.0 / state.maxVelocity *
+         100.0 / 360.0;
+}
+
+std::vector<std::int32_t>
+    Motor::get_raw_position_all(std::uint32_t *const timestamp) const {
+  return all(get_raw_position(timestamp));
+}
+
+double Motor::get_temperature(const std::uint8_t) const {
+  return sim::motor(Device::_port).temperature;
+}
+
+std::vector<double> Motor::get_temperature_all(void) const {
+  return all(get_temperature());
+}
+
+double Motor::get_torque(const std::uint8_t) const {
+  return get_current_draw() / 2500.0 * 2.1;
+}
+
+std::vector<double> Motor::get_torque_all(void) const {
+  return all(get_torque());
+}
+
+std::int32_t Motor::get_voltage(const std::uint8_t) const {
+  const sim::MotorState &state{sim::motor(Device::_port)};
+  return direction(_port) * sim::targetVelocity(state) / state.maxVelocity *
+         12000.0;
+}
+
+std::vector<std::int32_t> Motor::get_voltage_all(void) const {
+  return all(get_voltage());
+}
+
+std::int32_t Motor::is_over_current(const std::uint8_t) const {
+  return 0;
+}
+
+std::vector<std::int32_t> Motor::is_over_current_all(void) const {
+  return all(is_over_current());
+}
+
+std::int32_t Motor::is_over_temp(const std::uint8_t) const {
+  return sim::motor(Device::_port).temperature > 55.0;
+}
+
+std::vector<std::int32_t> Motor::is_over_temp_all(void) const {
+  return all(is_over_temp());
+}
+
+MotorBrake Motor::get_brake_mode(const std::uint8_t) const {
+  return static_cast<MotorBrake>(sim::motor(Device::_port).brakeMode);
+}
+
+std::vector<MotorBrake> Motor::get_brake_mode_all(void) const {
+  return all(get_brake_mode());
+}
+
+std::int32_t Motor::get_current_limit(const std::uint8_t) const {
+  return sim::motor(Device::_port).currentLimit;
+}
+
+std::vector<std::int32_t> Motor::get_current_limit_all(void) const {
+  return all(get_current_limit());
+}
+
+MotorUnits Motor::get_encoder_units(const std::uint8_t) const {
+  return static_cast<MotorUnits>(sim::motor(Device::_port).encoderUnits);
+}
+
+std::vector<MotorUnits> Motor::get_encoder_units_all(void) const {
+  return all(get_encoder_units());
+}
+
+MotorGears Motor::get_gearing(const std::uint8_t) const {
+  return static_cast<MotorGears>(sim::motor(Device::_port).gearset);
+}
+
+std::vector<MotorGears> Motor::get_gearing_all(void) const {
+  return all(get_gearing());
+}
+
+std::vector<std::int8_t> Motor::get_port_all(void) const {
+  return all(_port);
+}
+
+std::int32_t Motor::get_voltage_limit(const std::uint8_t) const {
+  return 12000;
+}
+
+std::vector<std::int32_t> Motor::get_voltage_limit_all(void) const {
+  return all(get_voltage_limit());
+}
+
+std::int32_t Motor::is_reversed(const std::uint8_t) const {
+  return _port < 0;
+}
+
+std::vector<std::int32_t> Motor::is_reversed_all(void) const {
+  return all(is_reversed());
+}
+
+std::int32_t Motor::set_brake_mode(const MotorBrake mode,
+                                   const std::uint8_t) const {
+  sim::motor(Device::_port).brakeMode = static_cast<std::int32_t>(mode);
+  return 1;
+}
+
+std::int32_t Motor::set_brake_mode(const motor_brake_mode_e_t mode,
+                                   const std::uint8_t) const {
+  return set_brake_mode(static_cast<MotorBrake>(mode));
+}
+
+std::int32_t Motor::set_brake_mode_all(const MotorBrake mode) const {
+  return set_brake_mode(mode);
+}
+
+std::int32_t Motor::set_brake_mode_all(const motor_brake_mode_e_t mode) const {
+  return set_brake_mode(mode);
+}
+
+std::int32_t Motor::set_current_limit(const std::int32_t limit,
+                                      const std::uint8_t) const {
+  sim::motor(Device::_port).currentLimit = limit;
+  return 1;
+}
+
+std::int32_t Motor::set_current_limit_all(const std::int32_t limit) const {
+  return set_current_limit(limit);
+}
+
+std::int32_t Motor::set_encoder_units(const MotorUnits units,
+                                      const std::uint8_t) const {
+  sim::motor(Device::_port).encoderUnits = static_cast<std::int32_t>(units);
+  return 1;
+}
+
+std::int32_t Motor::set_encoder_units(const motor_encoder_units_e_t units,
+                                      const std::uint8_t) const {
+  return set_encoder_units(static_cast<MotorUnits>(units));
+}
+
+std::int32_t Motor::set_encoder_units_all(const MotorUnits units) const {
+  return set_encoder_units(units);
+}
+
+std::int32_t
+    Motor::set_encoder_units_all(const motor_encoder_units_e_t units) const {
+  return set_encoder_units(units);
+}
+
+std::int32_t Motor::set_gearing(const MotorGears gearset,
+                                const std::uint8_t) const {
+  sim::MotorState &state{sim::motor(Device::_port)};
+  state.gearset = static_cast<std::int32_t>(gearset);
+  state.maxVelocity = sim::maxVelocityOf(gearset);
+  return 1;
+}
+
+std::int32_t Motor::set_gearing(const motor_gearset_e_t gearset,
+                                const std::uint8_t) const {
+  return set_gearing(static_cast<MotorGears>(gearset));
+}
+
+std::int32_t Motor::set_gearing_all(const MotorGears gearset) const {
+  return set_gearing(gearset);
+}
+
+std::int32_t Motor::set_gearing_all(const motor_gearset_e_t gearset) const {
+  return set_gearing(gearset);
+}
+
+std::int32_t Motor::set_reversed(const bool reverse, const std::uint8_t) {
+  _port = reverse ? -std::abs(_port) : std::abs(_port);
+  return 1;
+}
+
+std::int32_t Motor::set_reversed_all(const bool reverse) {
+  return set_reversed(reverse);
+}
+
+std::int32_t Motor::set_voltage_limit(const std::int32_t,
+                                      const std::uint8_t) const {
+  return 1;
+}
+
+std::int32_t Motor::set_voltage_limit_all(const std::int32_t limit) const {
+  return set_voltage_limit(limit);
+}
+
+std::int32_t Motor::set_zero_position(const double position,
+                                      const std::uint8_t) const {
+  sim::MotorState &state{sim::motor(Device::_port)};
+  state.position -= direction(_port) * position / sim::ticksPerDegree(state);
+  return 1;
+}
+
+std::int32_t Motor::set_zero_position_all(const double position) const {
+  return set_zero_position(position);
+}
+
+std::int32_t Motor::tare_position(const std::uint8_t) const {
+  sim::motor(Device::_port).position = 0.0;
+  return 1;
+}
+
+std::int32_t Motor::tare_position_all(void) const {
+  return tare_position();
+}
+
+std::int8_t Motor::get_port(const std::uint8_t) const {
+  return _port;
+}
+
+std::int8_t Motor::size(void) const {
+  return 1;
+}
+
+// IMU
+
+std::int32_t Imu::reset(bool blocking) const {
+  sim::IMUState &state{sim::imu(_port)};
+  state.calibratedUs = sim::now() + 2000000;
+  state.rotation = 0.0;
+  while(blocking && is_calibrating()) {
+    c::delay(10);
+  }
+  return 1;
+}
+
+std::int32_t Imu::set_data_rate(std::uint32_t) const {
+  return 1;
+}
+
+std::vector<Imu> Imu::get_all_devices() {
+  return devicesOfType<Imu>(DeviceType::imu);
+}
+
+double Imu::get_rotation() const {
+  return sim::imu(_port).rotation;
+}
+
+double Imu::get_heading() const {
+  const double heading{std::fmod(get_rotation(), 360.0)};
+  return heading < 0.0 ? heading + 360.0 : heading;
+}
+
+quaternion_s_t Imu::get_quaternion() const {
+  const double half{-get_rotation() * M_PI / 360.0};
+  return {0.0, 0.0, std::sin(half), std::cos(half)};
+}
+
+euler_s_t Imu::get_euler() const {
+  return {0.0, 0.0, get_yaw()};
+}
+
+double Imu::get_pitch() const {
+  return 0.0;
+}
+
+double Imu::get_roll() const {
+  return 0.0;
+}
+
+double Imu::get_yaw() const {
+  const double heading{get_heading()};
+  return heading > 180.0 ? heading - 360.0 : heading;
+}
+
+imu_gyro_s_t Imu::get_gyro_rate() const {
+  return {0.0, 0.0, 0.0};
+}
+
+std::int32_t Imu::tare_rotation() const {
+  return set_rotation(0.0);
+}
+
+std::int32_t Imu::tare_heading() const {
+  return set_heading(0.0);
+}
+
+std::int32_t Imu::tare_pitch() const {
+  return 1;
+}
+
+std::int32_t Imu::tare_yaw() const {
+  return set_yaw(0.0);
+}
+
+std::int32_t Imu::tare_roll() const {
+  return 1;
+}
+
+std::int32_t Imu::tare() const {
+  return tare_rotation();
+}
+
+std::int32_t Imu::tare_euler() const {
+  return tare_yaw();
+}
+
+std::int32_t Imu::set_heading(const double target) const {
+  return set_rotation(get_rotation() - get_heading() + target);
+}
+
+std::int32_t Imu::set_rotation(const double target) const {
+  sim::imu(_port).rotation = target;
+  return 1;
+}
+
+std::int32_t Imu::set_yaw(const double target) const {
+  return set_rotation(get_rotation() - get_yaw() + target);
+}
+
+std::int32_t Imu::set_pitch(const double) const {
+  return 1;
+}
+
+std::int32_t Imu::set_roll(const double) const {
+  return 1;
+}
+
+std::int32_t Imu::set_euler(const euler_s_t target) const {
+  return set_yaw(target.yaw);
+}
+
+imu_accel_s_t Imu::get_accel() const {
+  return {0.0, 0.0, 0.0};
+}
+
+ImuStatus Imu::get_status() const {
+  return is_calibrating() ? ImuStatus::calibrating : ImuStatus::ready;
+}
+
+bool Imu::is_calibrating() const {
+  return sim::now() < sim::imu(_port).calibratedUs;
+}
+
+imu_orientation_e_t Imu::get_physical_orientation() const {
+  return E_IMU_Z_UP;
+}
+
+// GPS
+
+std::int32_t Gps::initialize_full(double xInitial,
+                                  double yInitial,
+                                  double headingInitial,
+                                  double,
+                                  double) const {
+  return set_position(xInitial, yInitial, headingInitial);
+}
+
+std::int32_t Gps::set_offset(double, double) const {
+  return 1;
+}
+
+std::vector<Gps> Gps::get_all_devices() {
+  return devicesOfType<Gps>(DeviceType::gps);
+}
+
+gps_position_s_t Gps::get_offset() const {
+  return {0.0, 0.0};
+}
+
+std::int32_t Gps::set_position(double xInitial,
+                               double yInitial,
+                               double headingInitial) const {
+  sim::GPSState &state{sim::gps(_port)};
+  state.x = xInitial;
+  state.y = yInitial;
+  state.heading = headingInitial;
+  return 1;
+}
+
+std::int32_t Gps::set_data_rate(std::uint32_t) const {
+  return 1;
+}
+
+double Gps::get_error() const {
+  return sim::gps(_port).error;
+}
+
+gps_status_s_t Gps::get_position_and_orientation() const {
+  const sim::GPSState &state{sim::gps(_port)};
+  return {state.x, state.y, 0.0, 0.0, get_yaw()};
+}
+
+gps_position_s_t Gps::get_position() const {
+  return {get_position_x(), get_position_y()};
+}
+
+double Gps::get_position_x() const {
+  return sim::gps(_port).x;
+}
+
+double Gps::get_position_y() const {
+  return sim::gps(_port).y;
+}
+
+gps_orientation_s_t Gps::get_orientation() const {
+  return {0.0, 0.0, get_yaw()};
+}
+
+double Gps::get_pitch() const {
+  return 0.0;
+}
+
+double Gps::get_roll() const {
+  return 0.0;
+}
+
+double Gps::get_yaw() const {
+  const double heading{get_heading()};
+  return heading > 180.0 ? heading - 360.0 : heading;
+}
+
+double Gps::get_heading() const {
+  const double heading{std::fmod(sim::gps(_port).heading, 360.0)};
+  return heading < 0.0 ? heading + 360.0 : heading;
+}
+
+double Gps::get_heading_raw() const {
+  return sim::gps(_port).heading;
+}
+
+gps_gyro_s_t Gps::get_gyro_rate() const {
+  return {0.0, 0.0, 0.0};
+}
+
+double Gps::get_gyro_rate_x() const {
+  return 0.0;
+}
+
+double Gps::get_gyro_rate_y() const {
+  return 0.0;
+}
+
+double Gps::get_gyro_rate_z() const {
+  return 0.0;
+}
+
+gps_accel_s_t Gps::get_accel() const {
+  return {0.0, 0.0, 0.0};
+}
+
+double Gps::get_accel_x() const {
+  return 0.0;
+}
+
+double Gps::get_accel_y() const {
+  return 0.0;
+}
+
+double Gps::get_accel_z() const {
+  return 0.0;
+}
+
+// Rotation sensor
+
+Rotation::Rotation(const std::int8_t port) :
+    Device(std::abs(port), DeviceType::rotation) {
+  claim(_port, DeviceType::rotation);
+  sim::rotation(_port).reversed = port < 0;
+}
+
+std::int32_t Rotation::reset() {
+  return reset_position();
+}
+
+std::int32_t Rotation::set_data_rate(std::uint32_t) const {
+  return 1;
+}
+
+std::int32_t Rotation::set_position(std::uint32_t position) const {
+  sim::RotationState &state{sim::rotation(_port)};
+  state.position = state.reversed ? -double(position) : double(position);
+  return 1;
+}
+
+std::int32_t Rotation::reset_position(void) const {
+  return set_position(0);
+}
+
+std::vector<Rotation> Rotation::get_all_devices() {
+  std::vector<Rotation> rotations;
+  for(std::uint8_t port{1}; port <= 21; port++) {
+    if(sim::pluggedType(port) == DeviceType::rotation) {
+      rotations.push_back(Rotation{static_cast<std::int8_t>(port)});
+    }
+  }
+  return rotations;
+}
+
+std::int32_t Rotation::get_position() const {
+  const sim::RotationState &state{sim::rotation(_port)};
+  return state.reversed ? -state.position : state.position;
+}
+
+std::int32_t Rotation::get_velocity() const {
+  const sim::RotationState &state{sim::rotation(_port)};
+  return state.reversed ? -state.velocity : state.velocity;
+}
+
+std::int32_t Rotation::get_angle() const {
+  const std::int32_t angle{get_position() % 36000};
+  return angle < 0 ? angle + 36000 : angle;
+}
+
+std::int32_t Rotation::set_reversed(bool value) const {
+  sim::rotation(_port).reversed = value;
+  return 1;
+}
+
+std::int32_t Rotation::reverse() const {
+  return set_reversed(!get_reversed());
+}
+
+std::int32_t Rotation::get_reversed() const {
+  return sim::rotation(_port).reversed;
+}
+
+// Distance sensor
+
+Distance::Distance(const std::uint8_t port) :
+    Device(port, DeviceType::distance) {
+  claim(_port, DeviceType::distance);
+}
+
+std::int32_t Distance::get() {
+  return sim::distance(_port).distance;
+}
+
+std::int32_t Distance::get_distance() {
+  return get();
+}
+
+std::vector<Distance> Distance::get_all_devices() {
+  return devicesOfType<Distance>(DeviceType::distance);
+}
+
+std::int32_t Distance::get_confidence() {
+  return sim::distance(_port).confidence;
+}
+
+std::int32_t Distance::get_object_size() {
+  return sim::distance(_port).objectSize;
+}
+
+double Distance::get_object_velocity() {
+  return 0.0;
+}
+
+// Optical sensor
+
+Optical::Optical(const std::uint8_t port) : Device(port, DeviceType::optical) {
+  claim(_port, DeviceType::optical);
+}
+
+std::vector<Optical> Optical::get_all_devices() {
+  return devicesOfType<Optical>(DeviceType::optical);
+}
+
+double Optical::get_hue() {
+  return sim::optical(_port).hue;
+}
+
+double Optical::get_saturation() {
+  return sim::optical(_port).saturation;
+}
+
+double Optical::get_brightness() {
+  return sim::optical(_port).brightness;
+}
+
+std::int32_t Optical::get_proximity() {
+  return sim::optical(_port).proximity;
+}
+
+std::int32_t Optical::set_led_pwm(uint8_t value) {
+  sim::optical(_port).ledPWM = value;
+  return 1;
+}
+
+std::int32_t Optical::get_led_pwm() {
+  return sim::optical(_port).ledPWM;
+}
+
+c::optical_rgb_s_t Optical::get_rgb() {
+  return {};
+}
+
+c::optical_raw_s_t Optical::get_raw() {
+  return {};
+}
+
+c::optical_direction_e_t Optical::get_gesture() {
+  return c::NO_GESTURE;
+}
+
+c::optical_gesture_s_t Optical::get_gesture_raw() {
+  return {};
+}
+
+std::int32_t Optical::enable_gesture() {
+  return 1;
+}
+
+std::int32_t Optical::disable_gesture() {
+  return 1;
+}
+
+double Optical::get_integration_time() {
+  return 100.0;
+}
+
+std::int32_t Optical::set_integration_time(double) {
+  return 1;
+}
+
+// Controller
+
+Controller::Controller(controller_id_e_t id) : _id{id} {}
+
+std::int32_t Controller::is_connected(void) {
+  return sim::controller(_id).connected;
+}
+
+std::int32_t Controller::get_analog(controller_analog_e_t channel) {
+  return sim::controller(_id).analog[channel];
+}
+
+std::int32_t Controller::get_battery_capacity(void) {
+  return 100;
+}
+
+std::int32_t Controller::get_battery_level(void) {
+  return 100;
+}
+
+std::int32_t Controller::get_digital(controller_digital_e_t button) {
+  return (sim::controller(_id).digital >> button) & 1;
+}
+
+std::int32_t Controller::get_digital_new_press(controller_digital_e_t button) {
+  sim::ControllerState &state{sim::controller(_id)};
+  const std::uint32_t mask{1u << button};
+  const bool newPress{(state.digital & mask) && !(state.previousDigital & mask)};
+  state.previousDigital = (state.previousDigital & ~mask) | (state.digital & mask);
+  return newPress;
+}
+
+std::int32_t
+    Controller::set_text(std::uint8_t line, std::uint8_t, const char *str) {
+  sim::controller(_id).text[line % 3] = str;
+  return 1;
+}
+
+std::int32_t Controller::set_text(std::uint8_t line,
+                                  std::uint8_t col,
+                                  const std::string &str) {
+  return set_text(line, col, str.c_str());
+}
+
+std::int32_t Controller::clear_line(std::uint8_t line) {
+  sim::controller(_id).text[line % 3].clear();
+  return 1;
+}
+
+std::int32_t Controller::rumble(const char *) {
+  return 1;
+}
+
+std::int32_t Controller::clear(void) {
+  for(std::uint8_t line{0}; line < 3; line++) {
+    clear_line(line);
+  }
+  return 1;
+}
+} // namespace v5
+
+// Three wire ports
+
+namespace adi {
+Port::Port(std::uint8_t adi_port, adi_port_config_e_t type) :
+    Port({sim::internalADIPort, adi_port}, type) {}
+
+Port::Port(ext_adi_port_pair_t port_pair, adi_port_config_e_t type) :
+    _smart_port{port_pair.first},
+    _adi_port{port_pair.second} {
+  set_config(type);
+}
+
+std::int32_t Port::get_config() const {
+  return sim::adi(_adi_port, _smart_port).config;
+}
+
+std::int32_t Port::get_value() const {
+  return sim::adi(_adi_port, _smart_port).value;
+}
+
+std::int32_t Port::set_config(adi_port_config_e_t type) const {
+  sim::adi(_adi_port, _smart_port).config = type;
+  return 1;
+}
+
+std::int32_t Port::set_value(std::int32_t value) const {
+  sim::adi(_adi_port, _smart_port).value = value;
+  return 1;
+}
+
+ext_adi_port_tuple_t Port::get_port() const {
+  return {_smart_port, _adi_port, 0};
+}
+
+AnalogIn::AnalogIn(std::uint8_t adi_port) : Port(adi_port, E_ADI_ANALOG_IN) {}
+
+AnalogIn::AnalogIn(ext_adi_port_pair_t port_pair) :
+    Port(port_pair, E_ADI_ANALOG_IN) {}
+
+std::int32_t AnalogIn::calibrate() const {
+  return get_value();
+}
+
+std::int32_t AnalogIn::get_value_calibrated() const {
+  return get_value();
+}
+
+DigitalOut::DigitalOut(std::uint8_t adi_port, bool init_state) :
+    Port(adi_port, E_ADI_DIGITAL_OUT) {
+  set_value(init_state);
+}
+
+DigitalOut::DigitalOut(ext_adi_port_pair_t port_pair, bool init_state) :
+    Port(port_pair, E_ADI_DIGITAL_OUT) {
+  set_value(init_state);
+}
+
+DigitalIn::DigitalIn(std::uint8_t adi_port) : Port(adi_port, E_ADI_DIGITAL_IN) {}
+
+DigitalIn::DigitalIn(ext_adi_port_pair_t port_pair) :
+    Port(port_pair, E_ADI_DIGITAL_IN) {}
+
+std::int32_t DigitalIn::get_new_press() const {
+  sim::ADIState &state{sim::adi(_adi_port, _smart_port)};
+  const bool newPress{state.value && !state.pressed};
+  state.pressed = state.value;
+  return newPress;
+}
+
+Encoder::Encoder(std::uint8_t adi_port_top,
+                 std::uint8_t adi_port_bottom,
+                 bool reversed) :
+    Encoder({sim::internalADIPort, adi_port_top, adi_port_bottom}, reversed) {}
+
+Encoder::Encoder(ext_adi_port_tuple_t port_tuple, bool reversed) :
+    Port({std::get<0>(port_tuple), std::get<1>(port_tuple)},
+         E_ADI_LEGACY_ENCODER),
+    _port_pair{std::get<1>(port_tuple), std::get<2>(port_tuple)} {
+  sim::encoder(_adi_port, _smart_port).reversed = reversed;
+}
+
+std::int32_t Encoder::reset() const {
+  sim::encoder(_adi_port, _smart_port).ticks = 0.0;
+  return 1;
+}
+
+std::int32_t Encoder::get_value() const {
+  const sim::EncoderState &state{sim::encoder(_adi_port, _smart_port)};
+  return std::lround(state.reversed ? -state.ticks : state.ticks);
+}
+
+ext_adi_port_tuple_t Encoder::get_port() const {
+  return {_smart_port, _port_pair.first, _port_pair.second};
+}
+
+Potentiometer::Potentiometer(std::uint8_t adi_port,
+                             adi_potentiometer_type_e_t) :
+    AnalogIn(adi_port) {}
+
+Potentiometer::Potentiometer(ext_adi_port_pair_t port_pair,
+                             adi_potentiometer_type_e_t) :
+    AnalogIn(port_pair) {}
+
+double Potentiometer::get_angle() const {
+  return get_value() * 250.0 / 4095.0;
+}
+
+Led::Led(std::uint8_t adi_port, std::uint32_t length) :
+    Port(adi_port, E_ADI_DIGITAL_OUT),
+    _buffer(length, 0) {}
+
+Led::Led(ext_adi_port_pair_t port_pair, std::uint32_t length) :
+    Port(port_pair, E_ADI_DIGITAL_OUT),
+    _buffer(length, 0) {}
+
+std::int32_t Led::clear_all() {
+  return set_all(0);
+}
+
+std::int32_t Led::clear() {
+  return clear_all();
+}
+
+std::int32_t Led::update() const {
+  return 1;
+}
+
+std::int32_t Led::set_all(uint32_t color) {
+  std::fill(_buffer.begin(), _buffer.end(), color);
+  return update();
+}
+
+std::int32_t Led::set_pixel(uint32_t color, uint32_t pixel_position) {
+  if(pixel_position >= _buffer.size()) {
+    return 0;
+  }
+  _buffer[pixel_position] = color;
+  return update();
+}
+
+std::int32_t Led::clear_pixel(uint32_t pixel_position) {
+  return set_pixel(0, pixel_position);
+}
+
+std::int32_t Led::length() {
+  return _buffer.size();
+}
+
+Pneumatics::Pneumatics(std::uint8_t adi_port,
+                       bool start_extended,
+                       bool extended_is_low) :
+    DigitalOut(adi_port, start_extended != extended_is_low),
+    state{start_extended != extended_is_low},
+    extended_is_low{extended_is_low} {}
+
+Pneumatics::Pneumatics(ext_adi_port_pair_t port_pair,
+                       bool start_extended,
+                       bool extended_is_low) :
+    DigitalOut(port_pair, start_extended != extended_is_low),
+    state{start_extended != extended_is_low},
+    extended_is_low{extended_is_low} {}
+
+std::int32_t Pneumatics::extend() {
+  state = !extended_is_low;
+  return set_value(state);
+}
+
+std::int32_t Pneumatics::retract() {
+  state = extended_is_low;
+  return set_value(state);
+}
+
+std::int32_t Pneumatics::toggle() {
+  return is_extended() ? retract() : extend();
+}
+
+bool Pneumatics::is_extended() const {
+  return state != extended_is_low;
+}
+} // namespace adi
+} // namespace pros
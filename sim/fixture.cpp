@@ -0,0 +1,105 @@
+#include "fixture.hpp"
+
+namespace atum {
+namespace sim {
+Fixture::Fixture(const Logger::Level loggerLevel) :
+    Fixture{loggerLevel, Tuning{}} {}
+
+Fixture::Fixture(const Logger::Level loggerLevel, const Tuning &tuning) {
+  const Motor::Gearing driveGearing{pros::v5::MotorGears::blue, 48.0 / 36.0};
+  const Drive::Geometry geometry{11.862_in, 10.21_in};
+  const inch_t wheelCircumference{203.724231788_mm};
+  const inch_t forwardFromCenter{-0.209_in};
+  const inch_t sideFromCenter{1.791_in};
+
+  DifferentialDrive::Parameters plantParams;
+  plantParams.left = {-7, 8, -9, -10};
+  plantParams.right = {1, -2, 3, 4};
+  plantParams.ratio = driveGearing.ratio;
+  plantParams.track = getValueAs<meter_t>(geometry.track);
+  plantParams.circum = getValueAs<meter_t>(geometry.circum);
+  plantParams.imus = {14, 17};
+  plantParams.forward = {'A',
+                         getValueAs<meter_t>(wheelCircumference),
+                         getValueAs<meter_t>(forwardFromCenter)};
+  plantParams.side = {'C',
+                      getValueAs<meter_t>(wheelCircumference),
+                      getValueAs<meter_t>(sideFromCenter),
+                      true};
+  plant = std::make_unique<DifferentialDrive>(plantParams);
+
+  drive = std::make_unique<Drive>(
+      std::make_unique<Motor>(
+          plantParams.left, driveGearing, "left drive", loggerLevel),
+      std::make_unique<Motor>(
+          plantParams.right, driveGearing, "right drive", loggerLevel),
+      geometry,
+      loggerLevel);
+  std::unique_ptr<Odometry> tracker{std::make_unique<Odometry>(
+      std::make_unique<Odometer>(
+          'A', 'B', wheelCircumference, forwardFromCenter, false, loggerLevel),
+      std::make_unique<Odometer>(
+          'C', 'D', wheelCircumference, sideFromCenter, true, loggerLevel),
+      std::make_unique<IMU>(PortsList{14, 17}, false, loggerLevel),
+      drive.get(),
+      loggerLevel)};
+  odometry = tracker.get();
+  odometry->startBackgroundTasks();
+  drive->setTracker(std::move(tracker));
+
+  const meters_per_second_t maxV{76.5_in_per_s};
+  const meters_per_second_squared_t maxA{153_in_per_s_sq};
+
+  AngularProfile::Parameters turnMotionParams{
+      720_deg_per_s, 10000_deg_per_s_sq, 10000_deg_per_s_cb};
+  turnMotionParams.usePosition = true;
+  PID::Parameters turnPIDParams{tuning.turnKP, 0, 0, 0.875};
+  turnPIDParams.ffScaling = true;
+  turn = std::make_unique<Turn>(
+      drive.get(),
+      std::make_unique<AngularProfileFollower>(
+          AngularProfile{turnMotionParams},
+          AcceptableAngle{forever, 1_deg, 5_deg_per_s},
+          std::make_unique<PID>(turnPIDParams),
+          AccelerationConstants{0.75, 0.1},
+          std::make_unique<PID>(PID::Parameters{30.0, 0.0, 60.0}),
+          10_deg,
+          1.05,
+          loggerLevel),
+      loggerLevel);
+
+  LateralProfile::Parameters moveToMotionParams{maxV, maxA, 612_in_per_s_cb};
+  moveToMotionParams.usePosition = true;
+  PID::Parameters moveToVelocityPIDParams{tuning.moveToKP, 0, 0, 6};
+  moveToVelocityPIDParams.ffScaling = true;
+  const AccelerationConstants kA{2.5, 1.25};
+  moveTo = std::make_unique<MoveTo>(
+      drive.get(),
+      turn.get(),
+      std::make_unique<LateralProfileFollower>(
+          LateralProfile{moveToMotionParams},
+          AcceptableDistance{forever, 1_in, 1_in_per_s},
+          std::make_unique<PID>(moveToVelocityPIDParams),
+          kA,
+          std::make_unique<PID>(PID::Parameters{60}),
+          3_in,
+          1.05,
+          loggerLevel),
+      std::make_unique<PID>(PID::Parameters{0.375}),
+      0.5_tile,
+      loggerLevel);
+
+  PID::Parameters pathVelocityPIDParams{moveToVelocityPIDParams};
+  pathVelocityPIDParams.kP = tuning.pathKP;
+  Path::setDefaultParams({1_tile, maxV, maxA, maxA, geometry.track});
+  pathFollower = std::make_unique<PathFollower>(
+      drive.get(),
+      AcceptableDistance{forever},
+      std::make_unique<PID>(pathVelocityPIDParams),
+      std::make_unique<PID>(PID::Parameters{15}),
+      kA,
+      tuning.lookahead,
+      loggerLevel);
+}
+} // namespace sim
+} // namespace atum
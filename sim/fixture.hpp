@@ -0,0 +1,59 @@
+/**
+ * @file fixture.hpp
+ * @brief Includes the Fixture class, a simulated robot built the same way as
+ * the competition robots for exercising atum on the host.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "atum/atum.hpp"
+#include "sim.hpp"
+
+namespace atum {
+namespace sim {
+/**
+ * @brief A drive with odometry, turning, move to, and path following set up
+ * like RobotClone's, backed by a simulated differential drive.
+ *
+ */
+class Fixture {
+  public:
+  /**
+   * @brief The gains and distances worth sweeping, defaulting to RobotClone's.
+   *
+   */
+  struct Tuning {
+    double turnKP{2.0};
+    double moveToKP{6.0};
+    double pathKP{6.0};
+    meter_t lookahead{1_ft};
+  };
+
+  /**
+   * @brief Constructs the fixture. Starts odometry, but not any motions.
+   *
+   * @param loggerLevel
+   */
+  Fixture(const Logger::Level loggerLevel = Logger::Level::Warn);
+
+  /**
+   * @brief Constructs the fixture with the given tuning.
+   *
+   * @param loggerLevel
+   * @param tuning
+   */
+  Fixture(const Logger::Level loggerLevel, const Tuning &tuning);
+
+  std::unique_ptr<DifferentialDrive> plant;
+  std::unique_ptr<Drive> drive;
+  Odometry *odometry;
+  std::unique_ptr<Turn> turn;
+  std::unique_ptr<MoveTo> moveTo;
+  std::unique_ptr<PathFollower> pathFollower;
+};
+} // namespace sim
+} // namespace atum
@@ -0,0 +1,585 @@
+#include "pros/misc.hpp"
+#include "pros/rtos.hpp"
+#include "sim.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace atum {
+namespace sim {
+namespace {
+// Tasks run on their own host threads, but only the one holding the "baton"
+// (Kernel::running) ever executes. Control is handed over when a task delays,
+// so the program behaves as a cooperative RTOS on simulated time.
+enum class TaskStatus { Runnable, Suspended, Deleted };
+
+struct TaskRecord {
+  std::string name;
+  std::uint32_t priority{TASK_PRIORITY_DEFAULT};
+  TaskStatus status{TaskStatus::Runnable};
+  std::uint64_t wakeUs{0};
+  std::uint64_t order{0};
+  std::uint32_t notifyValue{0};
+  std::condition_variable turn;
+  // Stack use is sampled whenever the task blocks, measured from where its
+  // thread started.
+  std::uint32_t stackDepth{TASK_STACK_DEPTH_DEFAULT};
+  std::uintptr_t stackBase{0};
+  std::size_t peakStackBytes{0};
+};
+
+struct MutexRecord {
+  TaskRecord *owner{nullptr};
+};
+
+struct Kernel {
+  std::mutex mutex;
+  std::vector<TaskRecord *> tasks;
+  TaskRecord *running{nullptr};
+  std::atomic<std::uint64_t> nowUs{0};
+  std::uint64_t nextStepUs{stepPeriodUs};
+  std::uint64_t order{0};
+  std::vector<std::function<void(double)>> steppers;
+  std::atomic<std::uint8_t> competitionStatus{0};
+};
+
+// Intentionally leaked so tasks still parked at exit never see it destroyed.
+Kernel &kernel() {
+  static Kernel *k{new Kernel};
+  return *k;
+}
+
+thread_local TaskRecord *self{nullptr};
+
+using Lock = std::unique_lock<std::mutex>;
+
+void waitForTurn(Lock &lock) {
+  Kernel &k{kernel()};
+  self->turn.wait(lock, [&k]() { return k.running == self; });
+}
+
+TaskRecord *current(Lock &lock) {
+  if(!self) {
+    // The first thread to call into the kernel is adopted as the main task.
+    Kernel &k{kernel()};
+    self = new TaskRecord;
+    self->name = "main";
+    self->wakeUs = k.nowUs;
+    self->order = ++k.order;
+    k.tasks.push_back(self);
+    if(!k.running) {
+      k.running = self;
+    }
+    waitForTurn(lock);
+  }
+  return self;
+}
+
+void advanceTo(const std::uint64_t targetUs) {
+  Kernel &k{kernel()};
+  while(k.nextStepUs <= targetUs) {
+    k.nowUs = k.nextStepUs;
+    for(auto &stepper : k.steppers) {
+      stepper(stepPeriodUs / 1e6);
+    }
+    k.nextStepUs += stepPeriodUs;
+  }
+  k.nowUs = std::max<std::uint64_t>(k.nowUs, targetUs);
+}
+
+// Hands the baton to the next task to run: the earliest to wake, then the
+// highest priority, then the one that has waited the longest.
+void dispatch() {
+  Kernel &k{kernel()};
+  const std::uint64_t now{k.nowUs};
+  auto key = [now](const TaskRecord *task) {
+    return std::make_tuple(std::max(task->wakeUs, now),
+                           -static_cast<std::int64_t>(task->priority),
+                           task->order);
+  };
+  TaskRecord *next{nullptr};
+  for(TaskRecord *task : k.tasks) {
+    if(task->status == TaskStatus::Runnable &&
+       (!next || key(task) < key(next))) {
+      next = task;
+    }
+  }
+  k.running = next;
+  if(next) {
+    advanceTo(next->wakeUs);
+    next->turn.notify_one();
+  }
+}
+
+void block(Lock &lock, const std::uint64_t wakeUs) {
+  Kernel &k{kernel()};
+  TaskRecord *task{current(lock)};
+  const std::uintptr_t top{reinterpret_cast<std::uintptr_t>(&task)};
+  if(!task->stackBase) {
+    task->stackBase = top;
+  }
+  if(task->stackBase > top) {
+    task->peakStackBytes =
+        std::max<std::size_t>(task->peakStackBytes, task->stackBase - top);
+  }
+  task->wakeUs = wakeUs;
+  task->order = ++k.order;
+  dispatch();
+  waitForTurn(lock);
+}
+
+TaskRecord *resolve(Lock &lock, pros::task_t task) {
+  return task ? static_cast<TaskRecord *>(task) : current(lock);
+}
+
+void parkForever(Lock &lock) {
+  self->turn.wait(lock, []() { return false; });
+}
+} // namespace
+
+std::uint64_t now() {
+  return kernel().nowUs;
+}
+
+void addStepper(const std::function<void(double)> &stepper) {
+  Kernel &k{kernel()};
+  Lock lock{k.mutex};
+  k.steppers.push_back(stepper);
+}
+
+void setCompetitionStatus(const std::uint8_t status) {
+  kernel().competitionStatus = status;
+}
+} // namespace sim
+} // namespace atum
+
+using namespace atum::sim;
+
+namespace pros {
+namespace c {
+extern "C" {
+uint32_t millis(void) {
+  return kernel().nowUs / 1000;
+}
+
+uint64_t micros(void) {
+  return kernel().nowUs;
+}
+
+void task_delay(const uint32_t milliseconds) {
+  Kernel &k{kernel()};
+  Lock lock{k.mutex};
+  block(lock, k.nowUs + milliseconds * 1000ull);
+}
+
+void delay(const uint32_t milliseconds) {
+  task_delay(milliseconds);
+}
+
+void task_delay_until(uint32_t *const prev_time, const uint32_t delta) {
+  Kernel &k{kernel()};
+  Lock lock{k.mutex};
+  *prev_time += delta;
+  block(lock, std::max<std::uint64_t>(k.nowUs, *prev_time * 1000ull));
+}
+
+task_t task_create(task_fn_t function,
+                   void *const parameters,
+                   uint32_t prio,
+                   const uint16_t stack_depth,
+                   const char *const name) {
+  Kernel &k{kernel()};
+  Lock lock{k.mutex};
+  current(lock);
+  TaskRecord *task{new TaskRecord};
+  task->name = name ? name : "";
+  task->priority = prio;
+  task->stackDepth = stack_depth;
+  task->wakeUs = k.nowUs;
+  task->order = ++k.order;
+  k.tasks.push_back(task);
+  std::thread{[task, function, parameters]() {
+    self = task;
+    const char base{0};
+    task->stackBase = reinterpret_cast<std::uintptr_t>(&base);
+    {
+      Lock lock{kernel().mutex};
+      waitForTurn(lock);
+    }
+    function(parameters);
+    Lock lock{kernel().mutex};
+    task->status = TaskStatus::Deleted;
+    dispatch();
+  }}.detach();
+  return task;
+}
+
+void task_delete(task_t task) {
+  Kernel &k{kernel()};
+  Lock lock{k.mutex};
+  TaskRecord *record{resolve(lock, task)};
+  record->status = TaskStatus::Deleted;
+  // Like FreeRTOS, a deleted task's stack is dropped without unwinding.
+  if(record == self) {
+    dispatch();
+    parkForever(lock);
+  }
+}
+
+uint32_t task_get_priority(task_t task) {
+  Lock lock{kernel().mutex};
+  return resolve(lock, task)->priority;
+}
+
+void task_set_priority(task_t task, uint32_t prio) {
+  Lock lock{kernel().mutex};
+  resolve(lock, task)->priority = prio;
+}
+
+task_state_e_t task_get_state(task_t task) {
+  Kernel &k{kernel()};
+  Lock lock{k.mutex};
+  const TaskRecord *record{resolve(lock, task)};
+  switch(record->status) {
+    case TaskStatus::Deleted: return E_TASK_STATE_DELETED;
+    case TaskStatus::Suspended: return E_TASK_STATE_SUSPENDED;
+    default: break;
+  }
+  if(record == k.running) {
+    return E_TASK_STATE_RUNNING;
+  }
+  return record->wakeUs > k.nowUs ? E_TASK_STATE_BLOCKED : E_TASK_STATE_READY;
+}
+
+void task_suspend(task_t task) {
+  Lock lock{kernel().mutex};
+  TaskRecord *record{resolve(lock, task)};
+  if(record->status == TaskStatus::Deleted) {
+    return;
+  }
+  record->status = TaskStatus::Suspended;
+  if(record == self) {
+    dispatch();
+    waitForTurn(lock);
+  }
+}
+
+void task_resume(task_t task) {
+  Kernel &k{kernel()};
+  Lock lock{k.mutex};
+  TaskRecord *record{resolve(lock, task)};
+  if(record->status == TaskStatus::Suspended) {
+    record->status = TaskStatus::Runnable;
+    record->wakeUs = std::max<std::uint64_t>(record->wakeUs, k.nowUs);
+  }
+}
+
+uint32_t task_get_count(void) {
+  Kernel &k{kernel()};
+  Lock lock{k.mutex};
+  return std::count_if(k.tasks.begin(), k.tasks.end(), [](const auto *task) {
+    return task->status != TaskStatus::Deleted;
+  });
+}
+
+char *task_get_name(task_t task) {
+  Lock lock{kernel().mutex};
+  return resolve(lock, task)->name.data();
+}
+
+std::uint32_t task_get_stack_high_water_mark(task_t task) {
+  Lock lock{kernel().mutex};
+  const TaskRecord *record{resolve(lock, task)};
+  const std::size_t peakWords{record->peakStackBytes / sizeof(std::uint32_t)};
+  return peakWords < record->stackDepth ? record->stackDepth - peakWords : 0;
+}
+
+task_t task_get_by_name(const char *name) {
+  Kernel &k{kernel()};
+  Lock lock{k.mutex};
+  for(TaskRecord *task : k.tasks) {
+    if(task->status != TaskStatus::Deleted && task->name == name) {
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+task_t task_get_current() {
+  Lock lock{kernel().mutex};
+  return current(lock);
+}
+
+uint32_t task_notify_ext(task_t task,
+                         uint32_t value,
+                         notify_action_e_t action,
+                         uint32_t *prev_value) {
+  Lock lock{kernel().mutex};
+  TaskRecord *record{resolve(lock, task)};
+  if(prev_value) {
+    *prev_value = record->notifyValue;
+  }
+  switch(action) {
+    case E_NOTIFY_ACTION_BITS: record->notifyValue |= value; break;
+    case E_NOTIFY_ACTION_INCR: ++record->notifyValue; break;
+    case E_NOTIFY_ACTION_OWRITE: record->notifyValue = value; break;
+    case E_NOTIFY_ACTION_NO_OWRITE:
+      if(record->notifyValue) {
+        return 0;
+      }
+      record->notifyValue = value;
+      break;
+    default: break;
+  }
+  return 1;
+}
+
+uint32_t task_notify(task_t task) {
+  return task_notify_ext(task, 0, E_NOTIFY_ACTION_INCR, nullptr);
+}
+
+uint32_t task_notify_take(bool clear_on_exit, uint32_t timeout) {
+  const std::uint32_t start{millis()};
+  while(true) {
+    {
+      Lock lock{kernel().mutex};
+      TaskRecord *record{current(lock)};
+      if(record->notifyValue) {
+        const std::uint32_t value{record->notifyValue};
+        record->notifyValue = clear_on_exit ? 0 : value - 1;
+        return value;
+      }
+    }
+    if(timeout != TIMEOUT_MAX && millis() - start >= timeout) {
+      return 0;
+    }
+    task_delay(1);
+  }
+}
+
+bool task_notify_clear(task_t task) {
+  Lock lock{kernel().mutex};
+  TaskRecord *record{resolve(lock, task)};
+  const bool pending{record->notifyValue != 0};
+  record->notifyValue = 0;
+  return pending;
+}
+
+void task_join(task_t task) {
+  while(task_get_state(task) != E_TASK_STATE_DELETED) {
+    task_delay(1);
+  }
+}
+
+mutex_t mutex_create(void) {
+  return new MutexRecord;
+}
+
+bool mutex_take(mutex_t mutex, uint32_t timeout) {
+  MutexRecord *record{static_cast<MutexRecord *>(mutex)};
+  const std::uint32_t start{millis()};
+  while(true) {
+    {
+      Lock lock{kernel().mutex};
+      TaskRecord *task{current(lock)};
+      if(!record->owner) {
+        record->owner = task;
+        return true;
+      }
+    }
+    if(timeout != TIMEOUT_MAX && millis() - start >= timeout) {
+      return false;
+    }
+    task_delay(1);
+  }
+}
+
+bool mutex_give(mutex_t mutex) {
+  MutexRecord *record{static_cast<MutexRecord *>(mutex)};
+  Lock lock{kernel().mutex};
+  if(record->owner != current(lock)) {
+    return false;
+  }
+  record->owner = nullptr;
+  return true;
+}
+
+void mutex_delete(mutex_t mutex) {
+  delete static_cast<MutexRecord *>(mutex);
+}
+
+uint8_t competition_get_status(void) {
+  return kernel().competitionStatus;
+}
+
+uint8_t competition_is_disabled(void) {
+  return (competition_get_status() & COMPETITION_DISABLED) != 0;
+}
+
+uint8_t competition_is_connected(void) {
+  return (competition_get_status() & COMPETITION_CONNECTED) != 0;
+}
+
+uint8_t competition_is_autonomous(void) {
+  return (competition_get_status() & COMPETITION_AUTONOMOUS) != 0;
+}
+
+uint8_t competition_is_field(void) {
+  return (competition_get_status() & COMPETITION_SYSTEM) != 0;
+}
+
+uint8_t competition_is_switch(void) {
+  return competition_is_connected() && !competition_is_field();
+}
+} // extern "C"
+} // namespace c
+
+namespace competition {
+std::uint8_t get_status(void) {
+  return c::competition_get_status();
+}
+
+std::uint8_t is_autonomous(void) {
+  return c::competition_is_autonomous();
+}
+
+std::uint8_t is_connected(void) {
+  return c::competition_is_connected();
+}
+
+std::uint8_t is_disabled(void) {
+  return c::competition_is_disabled();
+}
+
+std::uint8_t is_field_control(void) {
+  return c::competition_is_field();
+}
+
+std::uint8_t is_competition_switch(void) {
+  return c::competition_is_switch();
+}
+} // namespace competition
+
+inline namespace rtos {
+Task::Task(task_fn_t function,
+           void *parameters,
+           std::uint32_t prio,
+           std::uint16_t stack_depth,
+           const char *name) :
+    task{c::task_create(function, parameters, prio, stack_depth, name)} {}
+
+Task::Task(task_fn_t function, void *parameters, const char *name) :
+    Task(function,
+         parameters,
+         TASK_PRIORITY_DEFAULT,
+         TASK_STACK_DEPTH_DEFAULT,
+         name) {}
+
+Task::Task(task_t iTask) : task{iTask} {}
+
+Task Task::current() {
+  return Task{c::task_get_current()};
+}
+
+Task &Task::operator=(task_t in) {
+  task = in;
+  return *this;
+}
+
+void Task::remove() {
+  c::task_delete(task);
+}
+
+std::uint32_t Task::get_priority() {
+  return c::task_get_priority(task);
+}
+
+void Task::set_priority(std::uint32_t prio) {
+  c::task_set_priority(task, prio);
+}
+
+std::uint32_t Task::get_state() {
+  return c::task_get_state(task);
+}
+
+void Task::suspend() {
+  c::task_suspend(task);
+}
+
+void Task::resume() {
+  c::task_resume(task);
+}
+
+const char *Task::get_name() {
+  return c::task_get_name(task);
+}
+
+std::uint32_t Task::notify() {
+  return c::task_notify(task);
+}
+
+void Task::join() {
+  c::task_join(task);
+}
+
+std::uint32_t Task::notify_ext(std::uint32_t value,
+                               notify_action_e_t action,
+                               std::uint32_t *prev_value) {
+  return c::task_notify_ext(task, value, action, prev_value);
+}
+
+std::uint32_t Task::notify_take(bool clear_on_exit, std::uint32_t timeout) {
+  return c::task_notify_take(clear_on_exit, timeout);
+}
+
+bool Task::notify_clear() {
+  return c::task_notify_clear(task);
+}
+
+void Task::delay(const std::uint32_t milliseconds) {
+  c::task_delay(milliseconds);
+}
+
+void Task::delay_until(std::uint32_t *const prev_time,
+                       const std::uint32_t delta) {
+  c::task_delay_until(prev_time, delta);
+}
+
+std::uint32_t Task::get_count() {
+  return c::task_get_count();
+}
+
+Clock::time_point Clock::now() {
+  return time_point{duration{c::millis()}};
+}
+
+Mutex::Mutex() : mutex{c::mutex_create(), c::mutex_delete} {}
+
+bool Mutex::take() {
+  return c::mutex_take(mutex.get(), TIMEOUT_MAX);
+}
+
+bool Mutex::take(std::uint32_t timeout) {
+  return c::mutex_take(mutex.get(), timeout);
+}
+
+bool Mutex::give() {
+  return c::mutex_give(mutex.get());
+}
+
+void Mutex::lock() {
+  take();
+}
+
+void Mutex::unlock() {
+  give();
+}
+
+bool Mutex::try_lock() {
+  return take(0);
+}
+} // namespace rtos
+} // namespace pros
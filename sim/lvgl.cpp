@@ -0,0 +1,248 @@
+#include "atum/gui/imgs/atumerror.hpp"
+#include "atum/gui/imgs/atumlogo.hpp"
+#include "liblvgl/lvgl.h"
+#include "sim.hpp"
+#include <cstdlib>
+#include <unordered_map>
+
+// Nothing is drawn on the host. Objects are opaque allocations, and only what
+// atum reads back (label text, image sources, dropdown selections, the active
+// screen) is kept.
+
+namespace atum {
+namespace sim {
+namespace {
+struct LVGLState {
+  std::unordered_map<const void *, std::string> labels;
+  std::unordered_map<const void *, const void *> images;
+  lv_obj_t *activeScreen{nullptr};
+  LVGLStats stats;
+};
+
+LVGLState &lvgl() {
+  static LVGLState *state{new LVGLState};
+  return *state;
+}
+
+template <typename T>
+T *createObject() {
+  lvgl().stats.objectsCreated++;
+  return static_cast<T *>(std::calloc(1, sizeof(T)));
+}
+} // namespace
+
+LVGLStats &lvglStats() {
+  return lvgl().stats;
+}
+
+std::string labelText(const void *label) {
+  const auto text{lvgl().labels.find(label)};
+  return text == lvgl().labels.end() ? "" : text->second;
+}
+} // namespace sim
+} // namespace atum
+
+using namespace atum;
+
+const lv_font_t lv_font_montserrat_12{};
+const lv_font_t lv_font_montserrat_20{};
+const lv_font_t lv_font_montserrat_36{};
+const lv_font_t lv_font_montserrat_48{};
+
+const lv_img_dsc_t atumlogo{};
+const lv_img_dsc_t atumerror{};
+
+extern "C" {
+lv_obj_t *lv_obj_create(lv_obj_t *) {
+  return sim::createObject<lv_obj_t>();
+}
+
+lv_obj_t *lv_btn_create(lv_obj_t *parent) {
+  return lv_obj_create(parent);
+}
+
+lv_obj_t *lv_label_create(lv_obj_t *parent) {
+  return lv_obj_create(parent);
+}
+
+lv_obj_t *lv_img_create(lv_obj_t *parent) {
+  return lv_obj_create(parent);
+}
+
+lv_obj_t *lv_switch_create(lv_obj_t *parent) {
+  return lv_obj_create(parent);
+}
+
+lv_obj_t *lv_dropdown_create(lv_obj_t *parent) {
+  return lv_obj_create(parent);
+}
+
+lv_obj_t *lv_chart_create(lv_obj_t *parent) {
+  return lv_obj_create(parent);
+}
+
+void lv_disp_load_scr(lv_obj_t *scr) {
+  sim::lvgl().activeScreen = scr;
+}
+
+lv_disp_t *lv_disp_get_default(void) {
+  return nullptr;
+}
+
+lv_obj_t *lv_disp_get_scr_act(lv_disp_t *) {
+  return sim::lvgl().activeScreen;
+}
+
+void lv_label_set_text(lv_obj_t *obj, const char *text) {
+  sim::lvgl().stats.labelWrites++;
+  sim::lvgl().labels[obj] = text ? text : "";
+}
+
+char *lv_label_get_text(const lv_obj_t *obj) {
+  return sim::lvgl().labels[obj].data();
+}
+
+void lv_label_set_long_mode(lv_obj_t *, lv_label_long_mode_t) {}
+
+void lv_img_set_src(lv_obj_t *obj, const void *src) {
+  sim::lvgl().images[obj] = src;
+}
+
+const void *lv_img_get_src(lv_obj_t *obj) {
+  return sim::lvgl().images[obj];
+}
+
+lv_obj_t *lv_dropdown_get_list(lv_obj_t *obj) {
+  return obj;
+}
+
+uint16_t lv_dropdown_get_selected(const lv_obj_t *) {
+  return 0;
+}
+
+void lv_dropdown_set_options(lv_obj_t *, const char *) {}
+
+lv_chart_series_t *
+    lv_chart_add_series(lv_obj_t *, lv_color_t, lv_chart_axis_t) {
+  return sim::createObject<lv_chart_series_t>();
+}
+
+void lv_chart_refresh(lv_obj_t *) {
+  sim::lvgl().stats.chartRefreshes++;
+}
+
+void lv_chart_set_all_value(lv_obj_t *, lv_chart_series_t *, lv_coord_t) {}
+
+void lv_chart_set_div_line_count(lv_obj_t *, uint8_t, uint8_t) {}
+
+void lv_chart_set_next_value(lv_obj_t *, lv_chart_series_t *, lv_coord_t) {
+  sim::lvgl().stats.chartPoints++;
+}
+
+void lv_chart_set_next_value2(lv_obj_t *,
+                              lv_chart_series_t *,
+                              lv_coord_t,
+                              lv_coord_t) {
+  sim::lvgl().stats.chartPoints++;
+}
+
+void lv_chart_set_point_count(lv_obj_t *, uint16_t) {}
+
+void lv_chart_set_range(lv_obj_t *, lv_chart_axis_t, lv_coord_t, lv_coord_t) {}
+
+void lv_chart_set_type(lv_obj_t *, lv_chart_type_t) {}
+
+void *lv_event_get_user_data(lv_event_t *) {
+  return nullptr;
+}
+
+struct _lv_event_dsc_t *
+    lv_obj_add_event_cb(lv_obj_t *, lv_event_cb_t, lv_event_code_t, void *) {
+  return nullptr;
+}
+
+void lv_obj_add_style(lv_obj_t *, lv_style_t *, lv_style_selector_t) {}
+
+void lv_obj_align(lv_obj_t *, lv_align_t, lv_coord_t, lv_coord_t) {}
+
+bool lv_obj_has_state(const lv_obj_t *, lv_state_t) {
+  return false;
+}
+
+void lv_obj_move_to_index(lv_obj_t *, int32_t) {}
+
+void lv_obj_set_flex_flow(lv_obj_t *, lv_flex_flow_t) {}
+
+void lv_obj_set_scroll_dir(lv_obj_t *, lv_dir_t) {}
+
+void lv_obj_set_scrollbar_mode(lv_obj_t *, lv_scrollbar_mode_t) {}
+
+void lv_obj_set_size(lv_obj_t *, lv_coord_t, lv_coord_t) {}
+
+void lv_obj_set_width(lv_obj_t *, lv_coord_t) {}
+
+void lv_obj_set_style_bg_color(lv_obj_t *, lv_color_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_bg_img_opa(lv_obj_t *, lv_opa_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_bg_img_src(lv_obj_t *, const void *, lv_style_selector_t) {
+}
+
+void lv_obj_set_style_bg_opa(lv_obj_t *, lv_opa_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_border_side(lv_obj_t *,
+                                  lv_border_side_t,
+                                  lv_style_selector_t) {}
+
+void lv_obj_set_style_height(lv_obj_t *, lv_coord_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_line_width(lv_obj_t *, lv_coord_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_max_height(lv_obj_t *, lv_coord_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_opa(lv_obj_t *, lv_opa_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_pad_bottom(lv_obj_t *, lv_coord_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_pad_left(lv_obj_t *, lv_coord_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_pad_right(lv_obj_t *, lv_coord_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_pad_top(lv_obj_t *, lv_coord_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_radius(lv_obj_t *, lv_coord_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_text_color(lv_obj_t *, lv_color_t, lv_style_selector_t) {}
+
+void lv_obj_set_style_text_font(lv_obj_t *,
+                                const lv_font_t *,
+                                lv_style_selector_t) {}
+
+void lv_obj_set_style_width(lv_obj_t *, lv_coord_t, lv_style_selector_t) {}
+
+void lv_style_init(lv_style_t *) {}
+
+void lv_style_set_bg_color(lv_style_t *, lv_color_t) {}
+
+void lv_style_set_bg_opa(lv_style_t *, lv_opa_t) {}
+
+void lv_style_set_border_color(lv_style_t *, lv_color_t) {}
+
+void lv_style_set_border_opa(lv_style_t *, lv_opa_t) {}
+
+void lv_style_set_border_side(lv_style_t *, lv_border_side_t) {}
+
+void lv_style_set_border_width(lv_style_t *, lv_coord_t) {}
+
+void lv_style_set_radius(lv_style_t *, lv_coord_t) {}
+
+void lv_style_set_shadow_opa(lv_style_t *, lv_opa_t) {}
+
+void lv_style_set_text_align(lv_style_t *, lv_text_align_t) {}
+
+void lv_style_set_text_color(lv_style_t *, lv_color_t) {}
+
+void lv_style_set_text_font(lv_style_t *, const lv_font_t *) {}
+
+void lv_style_set_text_letter_space(lv_style_t *, lv_coord_t) {}
+} // extern "C"
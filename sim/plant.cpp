@@ -0,0 +1,55 @@
+#include "sim.hpp"
+#include <cmath>
+
+namespace atum {
+namespace sim {
+DifferentialDrive::DifferentialDrive(const Parameters &iParams) :
+    params{iParams} {
+  for(const std::uint8_t port : params.imus) {
+    plug(port, pros::DeviceType::imu);
+  }
+  addStepper([this](const double dt) { step(dt); });
+}
+
+void DifferentialDrive::step(const double dt) {
+  const double left{sideVelocity(params.left)};
+  const double right{sideVelocity(params.right)};
+  v = (left + right) / 2.0;
+  // Clockwise is positive, so a faster left side turns the robot positively.
+  omega = (left - right) / params.track;
+  const double dh{omega * dt};
+  const double midH{h + dh / 2.0};
+  x += v * dt * std::sin(midH);
+  y += v * dt * std::cos(midH);
+  h += dh;
+
+  for(const std::uint8_t port : params.imus) {
+    imu(port).rotation += dh * 180.0 / M_PI;
+  }
+  // A tracking wheel offset from the center of rotation sweeps its own arc.
+  auto roll = [](const Odometer &odometer, const double traveled) {
+    if(!odometer.topPort || !odometer.circum) {
+      return;
+    }
+    const double ticks{traveled / odometer.circum * 4096.0};
+    EncoderState &state{encoder(odometer.topPort, odometer.smartPort)};
+    state.ticks += state.reversed ? -ticks : ticks;
+  };
+  roll(params.forward, v * dt - params.forward.fromCenter * dh);
+  roll(params.side, -params.side.fromCenter * dh);
+}
+
+double DifferentialDrive::sideVelocity(
+    const std::vector<std::int8_t> &ports) const {
+  if(ports.empty()) {
+    return 0.0;
+  }
+  double rpm{0.0};
+  for(const std::int8_t port : ports) {
+    rpm += (port < 0 ? -1.0 : 1.0) * motor(std::abs(port)).velocity;
+  }
+  rpm /= ports.size();
+  return rpm / params.ratio / 60.0 * params.circum;
+}
+} // namespace sim
+} // namespace atum
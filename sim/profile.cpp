@@ -0,0 +1,1204 @@
+#include "fixture.hpp"
+#include <chrono>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+// Profiles atum's control loops on the host. Simulated time runs as fast as
+// the host allows, so motions finish in a fraction of their real duration.
+
+using namespace atum;
+
+namespace {
+struct Measurement {
+  double wallMs;
+  double simS;
+  std::uint64_t allocations;
+};
+
+template <typename F>
+Measurement measure(F &&function) {
+  const auto startWall{std::chrono::steady_clock::now()};
+  const std::uint64_t startSim{sim::now()};
+  const std::uint64_t startAllocations{sim::allocations()};
+  function();
+  const std::chrono::duration<double, std::milli> wall{
+      std::chrono::steady_clock::now() - startWall};
+  return {wall.count(),
+          (sim::now() - startSim) / 1e6,
+          sim::allocations() - startAllocations};
+}
+
+void report(const char *name, const Measurement &measurement) {
+  std::printf("%-24s %9.3f s sim %10.2f ms wall %8.1fx %10llu allocs\n",
+              name,
+              measurement.simS,
+              measurement.wallMs,
+              measurement.simS * 1000.0 / measurement.wallMs,
+              static_cast<unsigned long long>(measurement.allocations));
+}
+
+void reportPose(sim::Fixture &fixture) {
+  const Pose tracked{fixture.drive->getPose()};
+  std::printf("  tracked (%.2f, %.2f, %.1f deg) true (%.2f, %.2f, %.1f deg) in\n",
+              getValueAs<inch_t>(tracked.x),
+              getValueAs<inch_t>(tracked.y),
+              getValueAs<degree_t>(tracked.h),
+              fixture.plant->x / 0.0254,
+              fixture.plant->y / 0.0254,
+              fixture.plant->h * 180.0 / M_PI);
+}
+// Estimates velocity from a recorded distance stream the way odometry does,
+// sampling every 10 ms with up to 1 ms of wake jitter, and returns the RMS
+// error against the true average velocity over each interval.
+double velocityNoise(const std::vector<double> &traveled,
+                     const bool microseconds) {
+  constexpr double tick{0.06985 * M_PI / 4096.0}; // A 2.75" wheel's encoder.
+  auto sample = [&traveled](const double t) {
+    const std::size_t i{static_cast<std::size_t>(t * 1000.0)};
+    const double fraction{t * 1000.0 - i};
+    return traveled[i] + (traveled[i + 1] - traveled[i]) * fraction;
+  };
+  std::uint32_t seed{12345};
+  double sumSquares{0.0};
+  int count{0};
+  double previousT{0.0};
+  double previousClock{0.0};
+  for(double base{0.01}; base < (traveled.size() - 2) / 1000.0; base += 0.01) {
+    seed = seed * 1664525u + 1013904223u;
+    const double t{base + (seed >> 8) / 16777216.0 * 0.001};
+    const double clock{microseconds ? std::floor(t * 1e6) / 1e6
+                                    : std::floor(t * 1e3) / 1e3};
+    const double delta{sample(t) - sample(previousT)};
+    const double measured{std::round(sample(t) / tick) * tick -
+                          std::round(sample(previousT) / tick) * tick};
+    const double estimate{measured / (clock - previousClock)};
+    const double truth{delta / (t - previousT)};
+    sumSquares += (estimate - truth) * (estimate - truth);
+    count++;
+    previousT = t;
+    previousClock = clock;
+  }
+  return std::sqrt(sumSquares / count);
+}
+
+// Hammers a pose snapshot from plain host threads, outside the simulated
+// kernel, with every field of each pose written set to the same value so a
+// torn read shows up as a mismatch.
+void snapshotStress() {
+  Snapshot<Pose> snapshot;
+  std::atomic<bool> done{false};
+  std::atomic<std::uint64_t> reads{0};
+  std::atomic<std::uint64_t> torn{0};
+  std::vector<std::thread> readers;
+  for(int i{0}; i < 4; i++) {
+    readers.emplace_back([&]() {
+      while(!done) {
+        const UnwrappedPose pose{snapshot.load()};
+        if(pose.x != pose.y || pose.x != pose.h || pose.x != pose.v ||
+           pose.x != pose.a || pose.x != pose.omega || pose.x != pose.alpha ||
+           pose.x != pose.t) {
+          torn++;
+        }
+        reads++;
+      }
+    });
+  }
+  constexpr int writes{2000000};
+  const auto startWall{std::chrono::steady_clock::now()};
+  for(int i{1}; i <= writes; i++) {
+    const double value{static_cast<double>(i)};
+    snapshot.store(UnwrappedPose{
+        value, value, value, value, value, value, value, value});
+  }
+  const std::chrono::duration<double, std::nano> wall{
+      std::chrono::steady_clock::now() - startWall};
+  done = true;
+  for(std::thread &reader : readers) {
+    reader.join();
+  }
+  std::printf("%-24s %9.1f ns/store %10llu reads %8llu torn\n",
+              "Snapshot<Pose> stress",
+              wall.count() / writes,
+              static_cast<unsigned long long>(reads.load()),
+              static_cast<unsigned long long>(torn.load()));
+}
+
+// The unsynchronized std::queue the ring buffer replaced, with a mutex added
+// so it is safe to compare against.
+template <typename T>
+class LockedQueue {
+  public:
+  bool push(T value) {
+    std::scoped_lock lock{mutex};
+    queue.push(std::move(value));
+    return true;
+  }
+
+  bool pop(T &value) {
+    std::scoped_lock lock{mutex};
+    if(queue.empty()) {
+      return false;
+    }
+    value = std::move(queue.front());
+    queue.pop();
+    return true;
+  }
+
+  private:
+  std::mutex mutex;
+  std::queue<T> queue;
+};
+
+// Runs the given number of producers on plain host threads against a single
+// consumer, returning millions of values passed through per second.
+template <typename Queue>
+double queueThroughput(Queue &queue, const int producers, const int perProducer) {
+  std::atomic<std::uint64_t> sum{0};
+  const auto startWall{std::chrono::steady_clock::now()};
+  std::vector<std::thread> threads;
+  for(int p{0}; p < producers; p++) {
+    threads.emplace_back([&queue, perProducer]() {
+      for(int i{1}; i <= perProducer; i++) {
+        while(!queue.push(i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  std::uint64_t received{0};
+  std::uint64_t total{0};
+  int value;
+  while(received < static_cast<std::uint64_t>(producers) * perProducer) {
+    if(queue.pop(value)) {
+      total += value;
+      received++;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  for(std::thread &thread : threads) {
+    thread.join();
+  }
+  const std::chrono::duration<double> wall{std::chrono::steady_clock::now() -
+                                           startWall};
+  const std::uint64_t expected{static_cast<std::uint64_t>(producers) *
+                               perProducer * (perProducer + 1ull) / 2};
+  if(total != expected) {
+    std::printf("  lost or duplicated values!\n");
+  }
+  return received / wall.count() / 1e6;
+}
+
+void queueBenchmarks() {
+  constexpr int operations{2000000};
+  auto singleThreaded = [](auto &queue) {
+    const std::uint64_t startAllocations{sim::allocations()};
+    const auto startWall{std::chrono::steady_clock::now()};
+    int value;
+    for(int i{0}; i < operations; i++) {
+      queue.push(i);
+      queue.pop(value);
+    }
+    const std::chrono::duration<double, std::nano> wall{
+        std::chrono::steady_clock::now() - startWall};
+    return std::make_pair(wall.count() / operations,
+                          sim::allocations() - startAllocations);
+  };
+  auto ring{std::make_unique<RingBuffer<int, 1024>>()};
+  auto locked{std::make_unique<LockedQueue<int>>()};
+  const auto [ringNs, ringAllocs]{singleThreaded(*ring)};
+  const auto [lockedNs, lockedAllocs]{singleThreaded(*locked)};
+  std::printf("%-24s %9.1f ns/op %10llu allocs  (locked std::queue %.1f ns/op "
+              "%llu allocs)\n",
+              "RingBuffer push+pop",
+              ringNs,
+              static_cast<unsigned long long>(ringAllocs),
+              lockedNs,
+              static_cast<unsigned long long>(lockedAllocs));
+  for(const int producers : {1, 4}) {
+    const double ringRate{queueThroughput(*ring, producers, operations / 4)};
+    const double lockedRate{queueThroughput(*locked, producers, operations / 4)};
+    std::printf("%-24s %9.2f M/s ring %10.2f M/s locked std::queue\n",
+                ("RingBuffer " + std::to_string(producers) + " producer(s)")
+                    .c_str(),
+                ringRate,
+                lockedRate);
+  }
+}
+
+// Checks "near a pose for 50 ms, unless turned past 45 deg" the way the
+// lambdas it replaces would and as an expression watching the tracker, first
+// in a tight loop and then every 1 ms during a turn, counting how often each
+// measures the distance.
+void conditionBenchmark(sim::Fixture &fixture) {
+  const Pose goal{fixture.drive->getPose()};
+  int lambdaMeasures{0};
+  int expressionMeasures{0};
+  const Condition lambda{[&fixture, &lambdaMeasures, goal]() {
+    lambdaMeasures++;
+    return distance(fixture.drive->getPose(), goal) <= 2_in &&
+           units::math::abs(fixture.drive->getPose().h - goal.h) < 45_deg;
+  }};
+  auto expression{
+      heldFor(when(fixture.odometry->getChangeSignal(),
+                   [&fixture, &expressionMeasures, goal]() {
+                     expressionMeasures++;
+                     return distance(fixture.drive->getPose(), goal) <= 2_in;
+                   }),
+              50_ms) &&
+      !when(fixture.odometry->getChangeSignal(), [&fixture, goal]() {
+        return units::math::abs(fixture.drive->getPose().h - goal.h) >= 45_deg;
+      })};
+  constexpr int checks{100000};
+  auto perCheck = [](auto &condition) {
+    const std::uint64_t startAllocations{sim::allocations()};
+    const auto startWall{std::chrono::steady_clock::now()};
+    int met{0};
+    for(int i{0}; i < checks; i++) {
+      met += condition();
+    }
+    const std::chrono::duration<double, std::nano> wall{
+        std::chrono::steady_clock::now() - startWall};
+    return std::make_tuple(wall.count() / checks,
+                           sim::allocations() - startAllocations,
+                           met);
+  };
+  const auto [lambdaNs, lambdaAllocs, lambdaMet]{perCheck(lambda)};
+  const auto [expressionNs, expressionAllocs, expressionMet]{
+      perCheck(expression)};
+  std::printf("%-24s %9.1f ns/check %7llu allocs  (lambda %.1f ns/check %llu "
+              "allocs)\n",
+              "Condition expression",
+              expressionNs,
+              static_cast<unsigned long long>(expressionAllocs),
+              lambdaNs,
+              static_cast<unsigned long long>(lambdaAllocs));
+  lambdaMeasures = 0;
+  expressionMeasures = 0;
+  pros::Task motion{[&fixture]() { fixture.turn->toward(-90_deg); }};
+  int disagreements{0};
+  for(int i{0}; i < 500; i++) {
+    const bool lambdaMet{lambda()};
+    const bool expressionMet{expression()};
+    // The expression also waits out heldFor, so it may only lag the lambda.
+    disagreements += expressionMet && !lambdaMet;
+    wait(1_ms);
+  }
+  // Lets the turn finish before anything else drives.
+  wait(1_s);
+  std::printf("  during a turn: %d distance measures vs %d, %d early\n",
+              expressionMeasures,
+              lambdaMeasures,
+              disagreements);
+}
+
+// Records a turn to telemetry and reports how compactly it was stored, then
+// times recording from a control loop.
+void telemetryBenchmark(sim::Fixture &fixture) {
+  const std::string filename{"telemetry.bin"};
+  Telemetry::start(filename);
+  const std::uint32_t startDropped{Telemetry::getDropped()};
+  report("Recorded Turn::toward", measure([&fixture]() {
+           fixture.turn->toward(0_deg);
+         }));
+  Telemetry::stop();
+  std::ifstream file{filename, std::ifstream::binary | std::ifstream::ate};
+  const long long bytes{static_cast<long long>(file.tellg())};
+  std::printf("  %lld bytes, %zu per record, %u dropped, decode with "
+              "./decode %s\n",
+              bytes,
+              sizeof(Telemetry::Record),
+              Telemetry::getDropped() - startDropped,
+              filename.c_str());
+
+  // Fewer than the buffer holds, so the flush task never runs in between.
+  const Telemetry::Channel channel{
+      Telemetry::addChannel("benchmark", {"a", "b", "c", "d", "e"})};
+  Telemetry::start("benchmark.bin");
+  constexpr int records{200};
+  const std::uint64_t startAllocations{sim::allocations()};
+  const auto startWall{std::chrono::steady_clock::now()};
+  for(int i{0}; i < records; i++) {
+    Telemetry::record(channel, i, 1.0, 2.0, 3.0, 4.0);
+  }
+  const std::chrono::duration<double, std::nano> wall{
+      std::chrono::steady_clock::now() - startWall};
+  const std::uint64_t allocations{sim::allocations() - startAllocations};
+  Telemetry::stop();
+  std::printf("%-24s %9.1f ns/call %10llu allocs\n",
+              "Telemetry::record",
+              wall.count() / records,
+              static_cast<unsigned long long>(allocations));
+}
+
+// Times updating metrics from a control loop and taking a snapshot of all of
+// them, then prints what the motions so far counted.
+void metricsBenchmark() {
+  static Metrics::Counter counter{"benchmark counter"};
+  static Metrics::Histogram histogram{"benchmark histogram",
+                                      {1, 2, 4, 8, 16, 32, 64}};
+  constexpr int updates{10000};
+  const std::uint64_t startAllocations{sim::allocations()};
+  auto startWall{std::chrono::steady_clock::now()};
+  for(int i{0}; i < updates; i++) {
+    counter.add();
+  }
+  std::chrono::duration<double, std::nano> counterWall{
+      std::chrono::steady_clock::now() - startWall};
+  startWall = std::chrono::steady_clock::now();
+  for(int i{0}; i < updates; i++) {
+    histogram.add(i % 100);
+  }
+  const std::chrono::duration<double, std::nano> histogramWall{
+      std::chrono::steady_clock::now() - startWall};
+  const std::uint64_t allocations{sim::allocations() - startAllocations};
+  std::printf("%-24s %9.1f ns/call %10llu allocs  (Histogram::add %.1f "
+              "ns/call)\n",
+              "Counter::add",
+              counterWall.count() / updates,
+              static_cast<unsigned long long>(allocations),
+              histogramWall.count() / updates);
+
+  std::vector<Metrics::Reading> readings;
+  const Measurement snapshot{measure([&readings]() {
+    for(int i{0}; i < 100; i++) {
+      readings = Metrics::snapshot();
+    }
+  })};
+  std::printf("%-24s %9.1f us/call %10.1f allocs/call  (%zu metrics)\n",
+              "Metrics::snapshot",
+              snapshot.wallMs * 10.0,
+              snapshot.allocations / 100.0,
+              readings.size());
+  for(const Metrics::Reading &reading : readings) {
+    std::printf("  %s\n", Metrics::toString(reading).c_str());
+  }
+}
+
+// Writes a full log screen's worth of lines many times over, in bursts like
+// the logger flushes them, against rebuilding the whole label for each line
+// as the log screen used to.
+void logScreenBenchmark() {
+  constexpr int messages{10000};
+  constexpr int burst{10};
+  const std::string message{" INFO: Tracker pose: (23.78 in, 47.56 in, 26.6 "
+                            "deg).\n"};
+  lv_obj_t *label{lv_label_create(nullptr)};
+  lv_label_set_text(label, "");
+  std::size_t labelLines{0};
+  auto startWall{std::chrono::steady_clock::now()};
+  for(int i{0}; i < messages; i++) {
+    std::string text{lv_label_get_text(label)};
+    if(labelLines >= GUI::Log::maxLogLines) {
+      text.erase(0, text.find('\n') + 1);
+    } else {
+      labelLines++;
+    }
+    text += message + '\n';
+    lv_label_set_text(label, text.c_str());
+  }
+  const std::chrono::duration<double, std::nano> rebuildWall{
+      std::chrono::steady_clock::now() - startWall};
+
+  const std::uint64_t startLabelWrites{sim::lvglStats().labelWrites};
+  const std::uint64_t startAllocations{sim::allocations()};
+  startWall = std::chrono::steady_clock::now();
+  for(int i{0}; i < messages; i++) {
+    GUI::Log::write(message);
+    if(i % burst == burst - 1) {
+      GUI::Log::refresh();
+    }
+  }
+  const std::chrono::duration<double, std::nano> ringWall{
+      std::chrono::steady_clock::now() - startWall};
+  std::printf("%-24s %9.1f ns/line %10llu allocs  (%.2f label writes/line, "
+              "rebuilt label %.1f ns/line)\n",
+              "Log screen",
+              ringWall.count() / messages,
+              static_cast<unsigned long long>(sim::allocations() -
+                                              startAllocations),
+              static_cast<double>(sim::lvglStats().labelWrites -
+                                  startLabelWrites) /
+                  messages,
+              rebuildWall.count() / messages);
+}
+
+// Graphs four series and maps a trail from a 100 Hz loop for 10 s, rendering
+// every display refresh, and reports what reached the charts. Each point used
+// to be drawn and the chart redrawn right away, from the loop itself.
+void chartBenchmark() {
+  constexpr int loops{1000};
+  constexpr int valuesPerLoop{4};
+  const sim::LVGLStats start{sim::lvglStats()};
+  const std::uint64_t startAllocations{sim::allocations()};
+  double queueNs{0.0};
+  for(int i{0}; i < loops; i++) {
+    const double t{i * 0.01};
+    const auto startWall{std::chrono::steady_clock::now()};
+    GUI::Graph::addValue(std::sin(t), GUI::SeriesColor::Red);
+    GUI::Graph::addValue(std::cos(t), GUI::SeriesColor::Green);
+    GUI::Graph::addValue(i % 50 ? 0.0 : 1.0, GUI::SeriesColor::Blue);
+    GUI::Graph::addValue(t / 10.0, GUI::SeriesColor::Cyan);
+    GUI::Map::addPosition({1_in * (i / 10), 0_in}, GUI::SeriesColor::Green);
+    const std::chrono::duration<double, std::nano> wall{
+        std::chrono::steady_clock::now() - startWall};
+    queueNs += wall.count();
+    if(i % 3 == 2) {
+      GUI::Graph::render();
+      GUI::Map::render();
+    }
+  }
+  GUI::Graph::render();
+  GUI::Map::render();
+  const sim::LVGLStats &end{sim::lvglStats()};
+  std::printf("%-24s %9.1f ns/point %10llu allocs  (%llu of %d points drawn, "
+              "%llu redraws)\n",
+              "Graph and Map",
+              queueNs / (loops * (valuesPerLoop + 1)),
+              static_cast<unsigned long long>(sim::allocations() -
+                                              startAllocations),
+              static_cast<unsigned long long>(end.chartPoints -
+                                              start.chartPoints),
+              loops * (valuesPerLoop + 1),
+              static_cast<unsigned long long>(end.chartRefreshes -
+                                              start.chartRefreshes));
+}
+
+// How much longer the mirrored forward wheel reads than the fixture's.
+double mirroredForwardScale{1.02};
+
+// Mirrors the fixture's odometers onto ADI ports E and G and its IMU onto port
+// 15, with the forward wheel reading mirroredForwardScale times as far, for
+// trackers run beside the fixture's odometry.
+void mirrorOdometry() {
+  static bool mirrored{false};
+  if(mirrored) {
+    return;
+  }
+  mirrored = true;
+  sim::plug(15, pros::DeviceType::imu);
+  double forwardTicks{sim::encoder('A').ticks};
+  double sideTicks{sim::encoder('C').ticks};
+  double rotation{sim::imu(14).rotation};
+  sim::addStepper(
+      [forwardTicks, sideTicks, rotation](const double) mutable {
+        sim::encoder('E').ticks +=
+            mirroredForwardScale * (sim::encoder('A').ticks - forwardTicks);
+        sim::encoder('G').ticks += sim::encoder('C').ticks - sideTicks;
+        sim::imu(15).rotation += sim::imu(14).rotation - rotation;
+        forwardTicks = sim::encoder('A').ticks;
+        sideTicks = sim::encoder('C').ticks;
+        rotation = sim::imu(14).rotation;
+      });
+}
+
+// Makes the odometers and IMU reading the mirrored sensors.
+std::unique_ptr<Odometer> mirroredForward() {
+  return std::make_unique<Odometer>(
+      'E', 'F', 203.724231788_mm, -0.209_in, false, Logger::Level::Warn);
+}
+
+std::unique_ptr<Odometer> mirroredSide() {
+  return std::make_unique<Odometer>(
+      'G', 'H', 203.724231788_mm, 1.791_in, true, Logger::Level::Warn);
+}
+
+std::unique_ptr<IMU> mirroredIMU() {
+  return std::make_unique<IMU>(PortsList{15}, false, Logger::Level::Warn);
+}
+
+Pose truePose(sim::Fixture &fixture) {
+  return {meter_t{fixture.plant->x},
+          meter_t{fixture.plant->y},
+          radian_t{fixture.plant->h}};
+}
+
+// Makes odometry alone on the mirrored sensors, to compare trackers with.
+std::unique_ptr<Odometry> mirroredDeadReckoning() {
+  return std::make_unique<Odometry>(mirroredForward(),
+                                    mirroredSide(),
+                                    mirroredIMU(),
+                                    nullptr,
+                                    Logger::Level::Warn);
+}
+
+// How far off a tracker and dead reckoning beside it ended up, in inches, and
+// the furthest one of the tracker's updates moved the pose beyond how far the
+// robot moved.
+struct Tracking {
+  double off;
+  double deadReckoningOff;
+  double maxCorrection;
+};
+
+// Runs the motion with the tracker and dead reckoning both tracking it from
+// the true pose, and reports it under the given name. The trackers should be
+// kept for the rest of the program, as the tracker's observer holds on to it.
+Tracking trackBeside(sim::Fixture &fixture,
+                     Odometry &tracker,
+                     Odometry &deadReckoning,
+                     const char *name,
+                     const std::function<void()> &motion) {
+  tracker.update();
+  deadReckoning.update();
+  tracker.setPose(truePose(fixture));
+  deadReckoning.setPose(truePose(fixture));
+  struct Correction {
+    Pose previous;
+    Pose previousTruth;
+    double max;
+  };
+  // Shared with the observer, which outlives this function.
+  const auto correction{std::make_shared<Correction>(
+      Correction{tracker.getPose(), truePose(fixture), 0.0})};
+  tracker.addObserver([&fixture, correction](const Pose &pose) {
+    const Pose current{truePose(fixture)};
+    correction->max = std::max(
+        correction->max,
+        getValueAs<inch_t>(distance(pose - correction->previous,
+                                    current - correction->previousTruth)));
+    correction->previous = pose;
+    correction->previousTruth = current;
+  });
+  tracker.startBackgroundTasks();
+  deadReckoning.startBackgroundTasks();
+  report(name, measure(motion));
+  // Frees the mirrored sensors for the next tracker.
+  tracker.stopBackgroundTasks();
+  deadReckoning.stopBackgroundTasks();
+  return {getValueAs<inch_t>(distance(tracker.getPose(), truePose(fixture))),
+          getValueAs<inch_t>(
+              distance(deadReckoning.getPose(), truePose(fixture))),
+          correction->max};
+}
+
+// Runs an EKF on the mirrored sensors, with a GPS with half an inch of noise.
+// It should stay on the true pose without jumping as GPS readings come in.
+void ekfBenchmark(sim::Fixture &fixture) {
+  constexpr std::uint8_t gpsPort{16};
+  constexpr double gpsNoise{0.0127};
+  mirrorOdometry();
+  sim::plug(gpsPort, pros::DeviceType::gps);
+  sim::gps(gpsPort).error = gpsNoise;
+  std::uint32_t seed{54321};
+  sim::addStepper([&fixture, seed](const double) mutable {
+    // Uniform noise with a standard deviation of gpsNoise.
+    auto noise = [&seed]() {
+      seed = seed * 1664525u + 1013904223u;
+      return ((seed >> 8) / 16777216.0 - 0.5) * std::sqrt(12.0) * gpsNoise;
+    };
+    sim::gps(gpsPort).x = fixture.plant->x + noise();
+    sim::gps(gpsPort).y = fixture.plant->y + noise();
+  });
+  static GPS gps{gpsPort, {}, 0.5, 1.0, Logger::Level::Warn};
+  // Kept for the rest of the program, as observers hold on to them.
+  static std::unique_ptr<EKF> ekf{
+      std::make_unique<EKF>(mirroredForward(),
+                            mirroredSide(),
+                            mirroredIMU(),
+                            nullptr,
+                            &gps,
+                            EKF::Parameters{},
+                            Logger::Level::Warn)};
+  static std::unique_ptr<Odometry> deadReckoning{mirroredDeadReckoning()};
+
+  // Simulated time doesn't pass between these, so the GPS is nudged to make
+  // every update take a new reading.
+  constexpr int updates{10000};
+  ekf->update();
+  const Measurement timing{measure([]() {
+    for(int i{0}; i < updates; i++) {
+      sim::gps(gpsPort).x += i % 2 ? 0.001 : -0.001;
+      ekf->update();
+    }
+  })};
+  const double loopMs{getValueAs<millisecond_t>(Odometry::period)};
+  std::printf("%-24s %9.1f ns/call %10.2f allocs/call  (%.3f%% of a %.0f ms "
+              "loop)\n",
+              "EKF::update",
+              timing.wallMs * 1e6 / updates,
+              static_cast<double>(timing.allocations) / updates,
+              timing.wallMs / updates / loopMs * 100.0,
+              loopMs);
+
+  const Tracking tracking{
+      trackBeside(fixture, *ekf, *deadReckoning, "EKF tracking", [&fixture]() {
+        fixture.moveTo->forward({1_tile, 1_tile});
+        fixture.turn->toward(90_deg);
+        fixture.moveTo->forward({2_tile, 1_tile});
+      })};
+  const EKF::Covariance covariance{ekf->getCovariance()};
+  std::printf("  %.2f in off (%.2f in without GPS), sd (%.2f in, %.2f in, "
+              "%.2f deg), %.2f in largest correction\n",
+              tracking.off,
+              tracking.deadReckoningOff,
+              std::sqrt(covariance[0][0]),
+              std::sqrt(covariance[1][1]),
+              std::sqrt(covariance[2][2]) * 180.0 / M_PI,
+              tracking.maxCorrection);
+}
+
+// Runs particle filters on the mirrored sensors, with distance sensors facing
+// left, right, and back ray cast against the walls. Each update's cost is
+// measured for a few particle counts, then one filter tracks a motion beside
+// odometry alone.
+void particleFilterBenchmark(sim::Fixture &fixture) {
+  struct Mount {
+    std::uint8_t port;
+    inch_t x;
+    inch_t y;
+    degree_t h;
+  };
+  static const std::array<Mount, 3> mounts{{{5, -6_in, 0_in, -90_deg},
+                                            {6, 6_in, 0_in, 90_deg},
+                                            {11, 0_in, -7_in, 180_deg}}};
+  const ParticleFilter::Parameters params;
+  const double wall{getValueAs<inch_t>(params.fieldHalfWidth)};
+  mirrorOdometry();
+  for(const Mount &mount : mounts) {
+    sim::plug(mount.port, pros::DeviceType::distance);
+  }
+  sim::addStepper([&fixture, wall](const double) {
+    const double h{fixture.plant->h};
+    for(const Mount &mount : mounts) {
+      const double x{getValueAs<inch_t>(mount.x)};
+      const double y{getValueAs<inch_t>(mount.y)};
+      const double originX{fixture.plant->x / 0.0254 + std::cos(h) * x +
+                           std::sin(h) * y};
+      const double originY{fixture.plant->y / 0.0254 - std::sin(h) * x +
+                           std::cos(h) * y};
+      const double direction{h + getValueAs<radian_t>(mount.h)};
+      const double toX{(std::copysign(wall, std::sin(direction)) - originX) /
+                       std::sin(direction)};
+      const double toY{(std::copysign(wall, std::cos(direction)) - originY) /
+                       std::cos(direction)};
+      const double range{std::min(toX, toY) * 25.4};
+      sim::distance(mount.port).distance =
+          range < 2000.0 ? static_cast<std::int32_t>(range) : 9999;
+    }
+  });
+  auto makeFilter = [&params](const std::size_t particles) {
+    std::vector<ParticleFilter::Beam> beams;
+    for(const Mount &mount : mounts) {
+      beams.push_back({std::make_unique<DistanceSensor>(
+                           mount.port, 0_mm, Logger::Level::Warn),
+                       mount.x,
+                       mount.y,
+                       mount.h});
+    }
+    ParticleFilter::Parameters sized{params};
+    sized.particles = particles;
+    return std::make_unique<ParticleFilter>(mirroredForward(),
+                                            mirroredSide(),
+                                            mirroredIMU(),
+                                            nullptr,
+                                            std::move(beams),
+                                            sized,
+                                            Logger::Level::Warn);
+  };
+
+  // Simulated time doesn't pass between these, so the forward wheel is rolled
+  // back and forth far enough for every update to correct.
+  constexpr int updates{1000};
+  const double rollTicks{1.5 * 4096.0 / getValueAs<inch_t>(203.724231788_mm)};
+  for(const std::size_t particles : {100, 500, 2000}) {
+    const std::unique_ptr<ParticleFilter> filter{makeFilter(particles)};
+    filter->setPose(truePose(fixture));
+    const Measurement timing{measure([&filter, rollTicks]() {
+      for(int i{0}; i < updates; i++) {
+        sim::encoder('E').ticks += i % 2 ? rollTicks : -rollTicks;
+        filter->update();
+      }
+    })};
+    const std::string name{"ParticleFilter (" + std::to_string(particles) +
+                           ")"};
+    const double loopMs{getValueAs<millisecond_t>(Odometry::period)};
+    std::printf("%-24s %9.1f us/call %10.2f allocs/call  (%.2f%% of a %.0f ms "
+                "loop)\n",
+                name.c_str(),
+                timing.wallMs * 1e3 / updates,
+                static_cast<double>(timing.allocations) / updates,
+                timing.wallMs / updates / loopMs * 100.0,
+                loopMs);
+  }
+
+  // Kept for the rest of the program, as observers hold on to them.
+  static std::unique_ptr<ParticleFilter> filter{makeFilter(500)};
+  static std::unique_ptr<Odometry> deadReckoning{mirroredDeadReckoning()};
+  const Tracking tracking{trackBeside(
+      fixture, *filter, *deadReckoning, "ParticleFilter tracking", [&fixture]() {
+        fixture.moveTo->forward({0_tile, -1_tile});
+        fixture.turn->toward(180_deg);
+        fixture.moveTo->forward({-1_tile, 0_tile});
+      })};
+  std::printf("  %.2f in off (%.2f in with odometry alone), %.2f in largest "
+              "correction\n",
+              tracking.off,
+              tracking.deadReckoningOff,
+              tracking.maxCorrection);
+}
+
+// Drives S-curves whose curvature swings from spinning one way to the other
+// a few times a second, tracked by odometry updated at a few rates on exact
+// copies of the fixture's sensors. Each update integrates an arc of constant
+// curvature, so the error comes from the curvature changing within updates.
+// The simulated encoders refresh every millisecond, but ADI encoders and motor
+// positions only refresh every 10 ms, so the faster rates only apply to
+// sensors that refresh faster, such as rotation sensors.
+void odometryRateBenchmark(sim::Fixture &fixture) {
+  mirrorOdometry();
+  mirroredForwardScale = 1.0;
+  constexpr std::array<int, 3> periods{10, 5, 2};
+  std::array<std::unique_ptr<Odometry>, periods.size()> trackers;
+  for(std::unique_ptr<Odometry> &tracker : trackers) {
+    tracker = mirroredDeadReckoning();
+  }
+  for(const std::unique_ptr<Odometry> &tracker : trackers) {
+    tracker->update();
+    tracker->setPose(truePose(fixture));
+  }
+  std::array<double, periods.size()> maxErrors{};
+  report("Odometry S-curves", measure([&]() {
+           for(int ms{0}; ms < 3000; ms++) {
+             if(ms % 10 == 0) {
+               const double turn{8.0 * std::sin(ms * 0.001 * 2.0 * M_PI * 1.5)};
+               fixture.drive->tank(4.0 + turn, 4.0 - turn);
+             }
+             wait(1_ms);
+             for(std::size_t i{0}; i < trackers.size(); i++) {
+               if(ms % periods[i] == 0) {
+                 trackers[i]->update();
+               }
+               maxErrors[i] = std::max(
+                   maxErrors[i],
+                   getValueAs<inch_t>(
+                       distance(trackers[i]->getPose(), truePose(fixture))));
+             }
+           }
+           fixture.drive->brake();
+         }));
+  for(std::size_t i{0}; i < trackers.size(); i++) {
+    const Pose tracked{trackers[i]->update()};
+    const Pose truth{truePose(fixture)};
+    std::printf("  every %2d ms: %.3f in and %.3f deg off, %.3f in at worst\n",
+                periods[i],
+                getValueAs<inch_t>(distance(tracked, truth)),
+                getValueAs<degree_t>(constrain180(tracked.h - truth.h)),
+                maxErrors[i]);
+  }
+  mirroredForwardScale = 1.02;
+}
+
+// Corrects odometry with a GPS whose readings arrive 50 ms after they are
+// taken, once blending them with the current pose and once with the pose the
+// tracker had when they were taken, on the mirrored sensors with the forward
+// wheel reading long. Also times looking up the pose at a past time.
+void latencyBenchmark(sim::Fixture &fixture) {
+  constexpr std::uint8_t gpsPort{18};
+  constexpr int latencyMs{50};
+  mirrorOdometry();
+  sim::plug(gpsPort, pros::DeviceType::gps);
+  sim::gps(gpsPort).error = 0.01;
+  // The true pose over the last latencyMs, read back as the GPS reading.
+  std::array<Pose, latencyMs> delayed;
+  delayed.fill(truePose(fixture));
+  std::size_t next{0};
+  sim::addStepper([&fixture, delayed, next](const double) mutable {
+    const Pose &reading{delayed[next]};
+    sim::gps(gpsPort).x = getValueAs<meter_t>(reading.x);
+    sim::gps(gpsPort).y = getValueAs<meter_t>(reading.y);
+    sim::gps(gpsPort).heading = getValueAs<degree_t>(reading.h);
+    delayed[next] = truePose(fixture);
+    next = (next + 1) % delayed.size();
+  });
+  static GPS naiveGPS{gpsPort, {}, 0.5, 1.0, Logger::Level::Warn};
+  static GPS compensatedGPS{
+      gpsPort, {}, 0.5, 1.0, Logger::Level::Warn, millisecond_t{latencyMs}};
+  std::array<GPS *, 2> gpses{&naiveGPS, &compensatedGPS};
+  std::array<std::unique_ptr<Odometry>, gpses.size()> trackers;
+  for(std::unique_ptr<Odometry> &tracker : trackers) {
+    tracker = mirroredDeadReckoning();
+  }
+  for(const std::unique_ptr<Odometry> &tracker : trackers) {
+    tracker->update();
+    tracker->setPose(truePose(fixture));
+  }
+  std::array<double, gpses.size()> errorSums{};
+  std::array<double, gpses.size()> maxErrors{};
+  int samples{0};
+  report("GPS latency", measure([&]() {
+           for(int ms{0}; ms < 3000; ms++) {
+             if(ms % 10 == 0) {
+               const double turn{3.0 * std::sin(ms * 0.001 * 2.0 * M_PI)};
+               fixture.drive->tank(6.0 + turn, 6.0 - turn);
+             }
+             wait(1_ms);
+             for(std::size_t i{0}; i < trackers.size(); i++) {
+               if(ms % 5 == 0) {
+                 trackers[i]->update();
+               }
+               if(ms % 100 == 99 && ms > 500) {
+                 gpses[i]->resetTracker(trackers[i].get());
+               }
+             }
+             if(ms > 500) {
+               samples++;
+               for(std::size_t i{0}; i < trackers.size(); i++) {
+                 const double error{getValueAs<inch_t>(
+                     distance(trackers[i]->getPose(), truePose(fixture)))};
+                 errorSums[i] += error;
+                 maxErrors[i] = std::max(maxErrors[i], error);
+               }
+             }
+           }
+           fixture.drive->brake();
+         }));
+  std::printf("  %.2f in off on average, %.2f in at worst (%.2f in and %.2f "
+              "in blending with the current pose)\n",
+              errorSums[1] / samples,
+              maxErrors[1],
+              errorSums[0] / samples,
+              maxErrors[0]);
+
+  // Times spread over the history, which is full by now.
+  Odometry &tracker{*trackers[1]};
+  const second_t now{tracker.getPose().t};
+  constexpr int queries{10000};
+  double sum{0.0};
+  const Measurement lookups{measure([&tracker, now, &sum]() {
+    for(int i{0}; i < queries; i++) {
+      const second_t time{
+          now - millisecond_t{static_cast<double>((i * 7) % 1200)}};
+      sum += getValueAs<inch_t>(tracker.getPose(time).x);
+    }
+  })};
+  std::printf("%-24s %9.1f ns/call %10.2f allocs/call\n",
+              "Tracker::getPose(time)",
+              lookups.wallMs * 1e6 / queries + 0.0 * sum,
+              static_cast<double>(lookups.allocations) / queries);
+}
+
+// Records the fixture's forward wheel every odometry update while driving back
+// and forth, read as a 360 tick per revolution encoder, then runs each
+// estimator over the recording. Lag is how far behind the true velocity or
+// acceleration each estimate fits best, and noise is how far off it is once
+// shifted by that lag.
+void derivativeBenchmark(sim::Fixture &fixture) {
+  const int periodMs{
+      static_cast<int>(getValueAs<millisecond_t>(Odometry::period))};
+  constexpr int durationMs{4000};
+  constexpr double ticksPerRevolution{360.0};
+  const double wheelInches{203.724231788 / 25.4};
+  // The true velocity every millisecond, and what the wheel read every update.
+  std::vector<double> trueV;
+  std::vector<double> readings;
+  trueV.reserve(durationMs);
+  readings.reserve(durationMs / periodMs);
+  const double startTicks{sim::encoder('A').ticks};
+  report("Recorded encoder stream", measure([&]() {
+           for(int ms{0}; ms < durationMs; ms++) {
+             if(ms % 10 == 0) {
+               const double t{ms * 0.001};
+               const double command{7.0 * std::sin(2.0 * M_PI * 0.75 * t) +
+                                    (std::fmod(t, 1.0) < 0.5 ? 3.0 : -3.0)};
+               fixture.drive->tank(command, command);
+             }
+             wait(1_ms);
+             trueV.push_back(getValueAs<inches_per_second_t>(
+                 meters_per_second_t{fixture.plant->v}));
+             if((ms + 1) % periodMs == 0) {
+               const double revolutions{(sim::encoder('A').ticks - startTicks) /
+                                        4096.0};
+               readings.push_back(
+                   std::floor(revolutions * ticksPerRevolution) /
+                   ticksPerRevolution * wheelInches);
+             }
+           }
+           fixture.drive->brake();
+         }));
+  std::vector<double> trueA(trueV.size(), 0.0);
+  for(std::size_t i{1}; i + 1 < trueV.size(); i++) {
+    trueA[i] = (trueV[i + 1] - trueV[i - 1]) / 0.002;
+  }
+
+  std::vector<std::pair<const char *, std::unique_ptr<DerivativeEstimator>>>
+      estimators;
+  estimators.emplace_back("FiniteDifference",
+                          std::make_unique<FiniteDifference>());
+  estimators.emplace_back("SavitzkyGolay (5)",
+                          std::make_unique<SavitzkyGolay>(5));
+  estimators.emplace_back("SavitzkyGolay (9)",
+                          std::make_unique<SavitzkyGolay>(9));
+  estimators.emplace_back("SavitzkyGolay (15)",
+                          std::make_unique<SavitzkyGolay>(15));
+  estimators.emplace_back("AlphaBetaGamma", std::make_unique<AlphaBetaGamma>());
+  estimators.emplace_back("KalmanDerivative",
+                          std::make_unique<KalmanDerivative>());
+  std::vector<DerivativeEstimator::Estimate> estimates(readings.size());
+  for(auto &[name, estimator] : estimators) {
+    const Measurement timing{measure([&readings, &estimates, &estimator]() {
+      double previous{0.0};
+      for(std::size_t i{0}; i < readings.size(); i++) {
+        estimates[i] =
+            estimator->update(readings[i] - previous, Odometry::period);
+        previous = readings[i];
+      }
+    })};
+    // Finds the shift that best lines each estimate up with the truth, after
+    // the first half second.
+    auto fit = [&](const std::vector<double> &truth, const bool rate) {
+      std::pair<int, double> best{0, INFINITY};
+      for(int lag{0}; lag <= 60; lag++) {
+        double squares{0.0};
+        int samples{0};
+        for(std::size_t i{static_cast<std::size_t>(500 / periodMs)};
+            i < estimates.size();
+            i++) {
+          const double estimate{rate ? estimates[i].rate
+                                     : estimates[i].acceleration};
+          const double error{estimate - truth[(i + 1) * periodMs - 1 - lag]};
+          squares += error * error;
+          samples++;
+        }
+        const double rms{std::sqrt(squares / samples)};
+        if(rms < best.second) {
+          best = {lag, rms};
+        }
+      }
+      return best;
+    };
+    const auto [vLag, vNoise]{fit(trueV, true)};
+    const auto [aLag, aNoise]{fit(trueA, false)};
+    std::printf("  %-20s v %2d ms lag %5.2f in/s noise, a %2d ms lag %6.1f "
+                "in/s^2 noise, %5.1f ns/update %.2f allocs/update\n",
+                name,
+                vLag,
+                vNoise,
+                aLag,
+                aNoise,
+                timing.wallMs * 1e6 / readings.size(),
+                static_cast<double>(timing.allocations) / readings.size());
+  }
+}
+
+void reportRate(const Movement &movement) {
+  const Rate &rate{movement.getRate()};
+  std::printf("  control loop at %.1f Hz with %.0f ms slip\n",
+              getValueAs<hertz_t>(rate.getFrequency()),
+              getValueAs<millisecond_t>(rate.getSlip()));
+}
+} // namespace
+
+int main() {
+  GUI::Manager::initialize();
+  sim::Fixture fixture;
+  // Reserved so recording doesn't count against the measured allocations.
+  std::vector<double> traveled;
+  traveled.reserve(1 << 15);
+  double distance{0.0};
+  sim::addStepper([&](const double dt) {
+    distance += std::abs(fixture.plant->v) * dt;
+    if(traveled.size() < traveled.capacity()) {
+      traveled.push_back(distance);
+    }
+  });
+
+  constexpr int updates{10000};
+  const Measurement odometry{measure([&fixture]() {
+    for(int i{0}; i < updates; i++) {
+      fixture.odometry->update();
+    }
+  })};
+  std::printf("%-24s %9.1f ns/call %10.2f allocs/call\n",
+              "Odometry::update",
+              odometry.wallMs * 1e6 / updates,
+              static_cast<double>(odometry.allocations) / updates);
+
+  // Read from every control loop and condition, so should do nothing else.
+  double sum{0.0};
+  const Measurement reads{measure([&fixture, &sum]() {
+    for(int i{0}; i < updates; i++) {
+      sum += getValueAs<inch_t>(fixture.drive->getPose().x);
+    }
+  })};
+  std::printf("%-24s %9.1f ns/call %10.2f allocs/call\n",
+              "Drive::getPose",
+              reads.wallMs * 1e6 / updates + 0.0 * sum,
+              static_cast<double>(reads.allocations) / updates);
+
+  // Odometry::update makes six debug calls per loop, which used to build
+  // their messages even when the logger was going to drop them.
+  Logger dropping{Logger::Level::Warn};
+  const Pose pose{fixture.drive->getPose()};
+  const Measurement eager{measure([&dropping, &pose]() {
+    for(int i{0}; i < updates; i++) {
+      dropping.debug("Tracker pose: " + toString(pose) + ".");
+    }
+  })};
+  const Measurement lazy{measure([&dropping, &pose]() {
+    for(int i{0}; i < updates; i++) {
+      LOG_DEBUG(dropping, "Tracker pose: " + toString(pose) + ".");
+    }
+  })};
+  std::printf("%-24s %9.1f ns/call %10.2f allocs/call  (eager %.1f ns/call "
+              "%.2f allocs/call)\n",
+              "Dropped LOG_DEBUG",
+              lazy.wallMs * 1e6 / updates,
+              static_cast<double>(lazy.allocations) / updates,
+              eager.wallMs * 1e6 / updates,
+              static_cast<double>(eager.allocations) / updates);
+
+  // After a thousand distinct messages, repeats of the errors a few motors
+  // log every loop should be suppressed as quickly as at the start.
+  // Only messages the level would print are checked for repeats, so what
+  // gets through is flushed away out of sight of the report.
+  Logger repeating{Logger::Level::Warn};
+  Logger::flush();
+  std::streambuf *const console{std::cout.rdbuf(nullptr)};
+  std::vector<std::string> messages;
+  for(int i{0}; i < 1000; i++) {
+    messages.push_back("Motor on port " + std::to_string(i) + " is hot.");
+  }
+  auto suppress = [&repeating, &messages](const int count) {
+    const auto startWall{std::chrono::steady_clock::now()};
+    for(int i{0}; i < updates; i++) {
+      repeating.warn(messages[i % count]);
+    }
+    const std::chrono::duration<double, std::nano> wall{
+        std::chrono::steady_clock::now() - startWall};
+    return wall.count() / updates;
+  };
+  const double fewNs{suppress(8)};
+  for(const std::string &message : messages) {
+    repeating.warn(message);
+  }
+  const std::uint64_t startAllocations{sim::allocations()};
+  const double afterNs{suppress(8)};
+  Logger::flush();
+  std::cout.rdbuf(console);
+  std::printf("%-24s %9.1f ns/call %10llu allocs  (%.1f ns/call before 1000 "
+              "messages)\n",
+              "Repeated Logger::warn",
+              afterNs,
+              static_cast<unsigned long long>(sim::allocations() -
+                                              startAllocations),
+              fewNs);
+
+  report("MoveTo::forward", measure([&fixture]() {
+           fixture.moveTo->forward({1_tile, 2_tile});
+         }));
+  reportPose(fixture);
+  reportRate(*fixture.moveTo);
+
+  report("Turn::toward", measure([&fixture]() {
+           fixture.turn->toward(-90_deg);
+         }));
+  reportPose(fixture);
+  reportRate(*fixture.turn);
+
+  report("PathFollower::follow", measure([&fixture]() {
+           fixture.pathFollower->follow(
+               {{AcceptableDistance{2_s}, Pose{-1_tile, 0_tile, -90_deg}}},
+               "profile");
+         }));
+  reportPose(fixture);
+  reportRate(*fixture.pathFollower);
+
+  const double millisecondNoise{velocityNoise(traveled, false)};
+  const double microsecondNoise{velocityNoise(traveled, true)};
+  std::printf("%-24s %9.2f in/s ms clock %6.2f in/s us clock %6.1f%% less\n",
+              "Velocity RMS error",
+              millisecondNoise / 0.0254,
+              microsecondNoise / 0.0254,
+              100.0 * (1.0 - microsecondNoise / millisecondNoise));
+
+  snapshotStress();
+  queueBenchmarks();
+
+  // Items due at staggered times should each run within a loop delay of
+  // becoming due, regardless of how many are pending.
+  Scheduler scheduler{Logger::Level::Warn};
+  constexpr int items{50};
+  std::vector<double> lateness(items, -1.0);
+  const second_t start{atum::time()};
+  int repeats{0};
+  scheduler.schedule({"repeat",
+                      Scheduler::neverMet,
+                      Scheduler::doNothing,
+                      100_ms,
+                      [&repeats]() { repeats++; },
+                      second_t{0_s}});
+  for(int i{0}; i < items; i++) {
+    const second_t due{start + i * 20_ms};
+    scheduler.schedule({"item " + std::to_string(i),
+                        [due]() { return atum::time() >= due; },
+                        [&lateness, i, due]() {
+                          lateness[i] = getValueAs<millisecond_t>(atum::time() - due);
+                        }});
+  }
+  report("Scheduler (50 items)", measure([]() { wait(1.5_s); }));
+  const int performed{static_cast<int>(
+      std::count_if(lateness.begin(), lateness.end(), [](const double late) {
+        return late >= 0.0;
+      }))};
+  std::printf("  %d/%d performed, max %.0f ms late, %d timeout repeats\n",
+              performed,
+              items,
+              *std::max_element(lateness.begin(), lateness.end()),
+              repeats);
+
+  // Overlapped with a turn, a sleep should add nothing past whichever is
+  // longer, and a timeout should interrupt a motion that runs past it.
+  second_t turnTime{0_s};
+  const Measurement overlapped{measure([&fixture, &turnTime]() {
+    const second_t begin{atum::time()};
+    whenAll(fixture.turn->async([&fixture, &turnTime, begin]() {
+      fixture.turn->toward(0_deg);
+      turnTime = atum::time() - begin;
+    }),
+            sleep(300_ms))
+        .run();
+  })};
+  report("Coroutine whenAll", overlapped);
+  std::printf("  %.0f ms sequential\n",
+              getValueAs<millisecond_t>(turnTime + 300_ms));
+  report("Coroutine withTimeout", measure([&fixture]() {
+           withTimeout(fixture.moveTo->async([&fixture]() {
+             fixture.moveTo->forward({0_tile, 0_tile});
+           }),
+                       250_ms)
+               .run();
+         }));
+  // Lets the interrupted motion notice before anything else drives.
+  wait(20_ms);
+  reportPose(fixture);
+
+  conditionBenchmark(fixture);
+  telemetryBenchmark(fixture);
+  metricsBenchmark();
+  logScreenBenchmark();
+  chartBenchmark();
+  ekfBenchmark(fixture);
+  particleFilterBenchmark(fixture);
+  odometryRateBenchmark(fixture);
+  latencyBenchmark(fixture);
+  derivativeBenchmark(fixture);
+
+  // Keeps anything logged so far ahead of what follows.
+  Logger::flush();
+  std::printf("\nBackground task timing:\n");
+  TaskStats::logAll();
+  // The simulator only sees how deep a task's stack is where it blocks, so
+  // these are lower bounds here, and no depths are suggested from them.
+  Logger::flush();
+  std::printf("\nStack depths:\n");
+  TaskStats::logStackDepths();
+  Logger::flush();
+  return 0;
+}
@@ -0,0 +1,156 @@
+#include "recording.hpp"
+#include "sim.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace atum {
+namespace sim {
+namespace {
+std::string readString(std::istream &in) {
+  std::string string;
+  std::getline(in, string, '\0');
+  return string;
+}
+} // namespace
+
+Recording::Recording(const std::string &filename) {
+  std::ifstream in{filename, std::ifstream::binary};
+  if(!in) {
+    error = "Could not open " + filename + ".";
+    return;
+  }
+  char magic[sizeof(Telemetry::magic)];
+  in.read(magic, sizeof(magic));
+  if(!in || std::memcmp(magic, Telemetry::magic, sizeof(magic))) {
+    error = filename + " is not a telemetry file of this version.";
+    return;
+  }
+  channels.resize(static_cast<unsigned char>(in.get()));
+  for(std::size_t i{0}; i < channels.size(); i++) {
+    const std::size_t id{static_cast<unsigned char>(in.get())};
+    const std::size_t fieldCount{static_cast<unsigned char>(in.get())};
+    const Telemetry::Precision precision{
+        static_cast<Telemetry::Precision>(in.get())};
+    if(id >= channels.size()) {
+      error = "Channel " + std::to_string(id) + " is out of range.";
+      return;
+    }
+    channels[id].name = readString(in);
+    channels[id].precision = precision;
+    for(std::size_t j{0}; j < fieldCount; j++) {
+      channels[id].fields.push_back(readString(in));
+    }
+  }
+
+  std::uint64_t time{0};
+  bool started{false};
+  Telemetry::Record record;
+  while(in.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+    if(record.channel == Telemetry::syncChannel) {
+      std::memcpy(&time, record.values.data(), sizeof(time));
+      if(!started) {
+        start = time;
+        started = true;
+      }
+      continue;
+    }
+    time += record.delta;
+    if(record.channel >= channels.size()) {
+      continue;
+    }
+    Sample sample{record.channel, time, {}};
+    if(channels[record.channel].precision == Telemetry::Precision::Double) {
+      std::memcpy(sample.values.data(),
+                  record.values.data(),
+                  sizeof(double) * Telemetry::maxPreciseFields);
+    } else {
+      std::copy(
+          record.values.begin(), record.values.end(), sample.values.begin());
+    }
+    samples.push_back(sample);
+  }
+  encoderChannel = findChannel("encoder");
+  imuChannel = findChannel("imu");
+  motorChannel = findChannel("motor readings");
+}
+
+bool Recording::isLoaded(std::string *iError) const {
+  if(iError) {
+    *iError = error;
+  }
+  return error.empty();
+}
+
+const std::vector<Recording::Channel> &Recording::getChannels() const {
+  return channels;
+}
+
+const std::vector<Recording::Sample> &Recording::getSamples() const {
+  return samples;
+}
+
+std::uint64_t Recording::getStart() const {
+  return start;
+}
+
+std::optional<Telemetry::Channel>
+    Recording::findChannel(const std::string &name) const {
+  for(std::size_t i{0}; i < channels.size(); i++) {
+    if(channels[i].name == name) {
+      return i;
+    }
+  }
+  return std::nullopt;
+}
+
+void Recording::replay() {
+  const std::uint64_t offset{now() - start};
+  addStepper([this, offset](double) {
+    while(next < samples.size() && samples[next].time + offset <= now()) {
+      const Sample &sample{samples[next++]};
+      if(sample.channel != encoderChannel && sample.channel != imuChannel &&
+         sample.channel != motorChannel) {
+        continue;
+      }
+      // Devices are told apart by their ports, the first value or two.
+      auto held{std::find_if(
+          latest.begin(), latest.end(), [this, &sample](const Sample *device) {
+            return device->channel == sample.channel &&
+                   device->values[0] == sample.values[0] &&
+                   (sample.channel != encoderChannel ||
+                    device->values[1] == sample.values[1]);
+          })};
+      if(held == latest.end()) {
+        latest.push_back(&sample);
+      } else {
+        *held = &sample;
+      }
+    }
+    // Reapplied every step, since models like the drive's write the same
+    // devices.
+    for(const Sample *sample : latest) {
+      apply(*sample);
+    }
+  });
+}
+
+void Recording::apply(const Sample &sample) const {
+  const double *values{sample.values.data()};
+  if(sample.channel == encoderChannel) {
+    EncoderState &state{encoder(values[1], values[0])};
+    state.ticks = state.reversed ? -values[2] : values[2];
+  } else if(sample.channel == imuChannel) {
+    imu(values[0]).rotation = values[1];
+  } else if(sample.channel == motorChannel) {
+    // atum uses the motors' degree encoder units and unreversed ports, so the
+    // raw readings are the state.
+    MotorState &state{motor(std::abs(values[0]))};
+    state.position = values[1];
+    state.velocity = values[2];
+    state.updatedUs = now();
+  }
+}
+} // namespace sim
+} // namespace atum
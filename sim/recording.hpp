@@ -0,0 +1,131 @@
+/**
+ * @file recording.hpp
+ * @brief Includes the Recording class, which reads telemetry files and replays
+ * the sensor readings in them through the simulated devices.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "atum/utility/telemetry.hpp"
+#include <array>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace atum {
+namespace sim {
+/**
+ * @brief A telemetry file (see atum::Telemetry) read into memory.
+ *
+ * Replaying a recording holds every device at its most recently recorded
+ * reading, so atum reads exactly what it read when the recording was made.
+ * Odometers, IMUs, and motors are replayed. As long as the same code runs from
+ * the same time after recording started, it then computes exactly the same
+ * poses and commands. Readings are replayed open loop, so code that commands
+ * something different still sees the recorded motion.
+ *
+ * Readings are only replayed at whole simulated milliseconds. Recordings from
+ * the brain replay exactly if its loops ran on whole milliseconds since
+ * recording started, as Rate and delay keep them.
+ *
+ */
+class Recording {
+  public:
+  /**
+   * @brief A channel described in the header.
+   *
+   */
+  struct Channel {
+    std::string name;
+    std::vector<std::string> fields;
+    Telemetry::Precision precision;
+  };
+
+  /**
+   * @brief A record with its full time and values widened to doubles.
+   *
+   */
+  struct Sample {
+    Telemetry::Channel channel;
+    std::uint64_t time; // In microseconds.
+    std::array<double, Telemetry::maxFields> values;
+  };
+
+  /**
+   * @brief Reads the given telemetry file. Check isLoaded before using it.
+   *
+   * @param filename
+   */
+  Recording(const std::string &filename);
+
+  /**
+   * @brief Checks if the file was read, and gets why not if it wasn't.
+   *
+   * @param error Set to why the file couldn't be read, if given.
+   * @return true
+   * @return false
+   */
+  bool isLoaded(std::string *error = nullptr) const;
+
+  /**
+   * @brief Gets the channels described in the header, indexed by id.
+   *
+   * @return const std::vector<Channel>&
+   */
+  const std::vector<Channel> &getChannels() const;
+
+  /**
+   * @brief Gets every record but sync records, in the order recorded.
+   *
+   * @return const std::vector<Sample>&
+   */
+  const std::vector<Sample> &getSamples() const;
+
+  /**
+   * @brief Gets the time recording started, in microseconds.
+   *
+   * @return std::uint64_t
+   */
+  std::uint64_t getStart() const;
+
+  /**
+   * @brief Finds the id of the channel with the given name.
+   *
+   * @param name
+   * @return std::optional<Telemetry::Channel>
+   */
+  std::optional<Telemetry::Channel> findChannel(const std::string &name) const;
+
+  /**
+   * @brief Starts replaying the recorded sensor readings into the simulated
+   * devices, as if recording started now. Should be called where recording
+   * was started, and the recording should outlive the simulation.
+   *
+   */
+  void replay();
+
+  private:
+  /**
+   * @brief Writes a recorded reading into the simulated device it came from.
+   *
+   * @param sample
+   */
+  void apply(const Sample &sample) const;
+
+  std::vector<Channel> channels;
+  std::vector<Sample> samples;
+  std::uint64_t start{0};
+  std::string error;
+
+  std::optional<Telemetry::Channel> encoderChannel;
+  std::optional<Telemetry::Channel> imuChannel;
+  std::optional<Telemetry::Channel> motorChannel;
+  std::size_t next{0};
+  std::vector<const Sample *> latest; // One for each device.
+};
+} // namespace sim
+} // namespace atum
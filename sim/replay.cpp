@@ -0,0 +1,333 @@
+#include "fixture.hpp"
+#include "recording.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Records a routine driven by the simulated drive, then replays the recorded
+// sensor readings through the same routine and checks every pose, profile
+// reference, controller output, and motor command comes out the same. Given
+// parameter sweeps, also replays the recording with every combination of the
+// swept parameters and compares what they would have commanded.
+//
+//   ./replay [recording.bin] [turnKP=1.5,2,2.5] [lookahead=9,12] [-j jobs]
+//
+// Sweepable parameters are the fields of sim::Fixture::Tuning: turnKP,
+// moveToKP, pathKP, and lookahead in inches. The recording is made first if
+// the file doesn't exist, and a recording from the brain of the same routine
+// can be replayed in its place. Each run is a separate process, since the
+// simulation is global, so runs are spread across cores.
+
+using namespace atum;
+
+namespace {
+// Channels that are computed from readings rather than read, with how many of
+// their fields are. The motor channel's velocity and current are read when
+// the command is sent, which isn't replayed.
+const std::vector<std::pair<std::string, std::size_t>> computedChannels{
+    {"odometry", Telemetry::maxFields},
+    {"profile m", Telemetry::maxFields},
+    {"profile rad", Telemetry::maxFields},
+    {"controller", Telemetry::maxFields},
+    {"motor", 2}};
+
+struct Sweep {
+  std::string name;
+  std::vector<double> values;
+};
+
+struct Config {
+  std::string label;
+  sim::Fixture::Tuning tuning;
+};
+
+// Written by each replay's process to its parent.
+struct Result {
+  std::size_t compared{0};
+  std::size_t mismatched{0};
+  double firstMismatchS{-1.0};
+  double rmsVoltageDifference{0.0};
+  double maxVoltageDifference{0.0};
+  double wallMs{0.0};
+  bool loaded{false};
+};
+
+void routine(sim::Fixture &fixture) {
+  fixture.moveTo->forward({1_tile, 2_tile});
+  fixture.turn->toward(-90_deg);
+  fixture.pathFollower->follow(
+      {{AcceptableDistance{2_s}, Pose{-1_tile, 0_tile, -90_deg}}}, "replay");
+}
+
+void record(const std::string &filename) {
+  GUI::Manager::initialize();
+  sim::Fixture fixture;
+  Telemetry::start(filename);
+  routine(fixture);
+  Telemetry::stop();
+}
+
+Result compare(const sim::Recording &original,
+               const sim::Recording &replayed) {
+  Result result;
+  result.loaded = true;
+  double sumSquares{0.0};
+  std::size_t voltages{0};
+  for(const auto &[name, fields] : computedChannels) {
+    const std::optional<Telemetry::Channel> originalChannel{
+        original.findChannel(name)};
+    const std::optional<Telemetry::Channel> replayedChannel{
+        replayed.findChannel(name)};
+    if(!originalChannel || !replayedChannel) {
+      continue;
+    }
+    std::vector<const sim::Recording::Sample *> originalSamples;
+    std::vector<const sim::Recording::Sample *> replayedSamples;
+    for(const sim::Recording::Sample &sample : original.getSamples()) {
+      if(sample.channel == originalChannel) {
+        originalSamples.push_back(&sample);
+      }
+    }
+    for(const sim::Recording::Sample &sample : replayed.getSamples()) {
+      if(sample.channel == replayedChannel) {
+        replayedSamples.push_back(&sample);
+      }
+    }
+    const std::size_t count{
+        std::max(originalSamples.size(), replayedSamples.size())};
+    for(std::size_t i{0}; i < count; i++) {
+      result.compared++;
+      const bool both{i < originalSamples.size() && i < replayedSamples.size()};
+      const sim::Recording::Sample *a{both ? originalSamples[i] : nullptr};
+      const sim::Recording::Sample *b{both ? replayedSamples[i] : nullptr};
+      // Compared bit for bit, so NaNs match too.
+      const bool same{both &&
+                      a->time - original.getStart() ==
+                          b->time - replayed.getStart() &&
+                      !std::memcmp(a->values.data(),
+                                   b->values.data(),
+                                   fields * sizeof(double))};
+      if(!same) {
+        result.mismatched++;
+        const sim::Recording::Sample *first{
+            i < originalSamples.size() ? originalSamples[i] :
+                                         replayedSamples[i]};
+        const double time{(first->time - (i < originalSamples.size() ?
+                                               original.getStart() :
+                                               replayed.getStart())) /
+                          1e6};
+        if(result.firstMismatchS < 0.0 || time < result.firstMismatchS) {
+          result.firstMismatchS = time;
+        }
+      }
+      if(both && name == "motor") {
+        const double difference{std::abs(a->values[1] - b->values[1])};
+        sumSquares += difference * difference;
+        voltages++;
+        result.maxVoltageDifference =
+            std::max(result.maxVoltageDifference, difference);
+      }
+    }
+  }
+  result.rmsVoltageDifference = voltages ? std::sqrt(sumSquares / voltages) :
+                                           0.0;
+  return result;
+}
+
+Result replay(const std::string &filename,
+              const sim::Fixture::Tuning &tuning,
+              const std::size_t index) {
+  const auto startWall{std::chrono::steady_clock::now()};
+  GUI::Manager::initialize();
+  sim::Recording original{filename};
+  if(!original.isLoaded()) {
+    return {};
+  }
+  sim::Fixture fixture{Logger::Level::Warn, tuning};
+  const std::string replayFilename{"replay_" + std::to_string(index) + ".bin"};
+  original.replay();
+  Telemetry::start(replayFilename);
+  routine(fixture);
+  Telemetry::stop();
+  Result result{compare(original, sim::Recording{replayFilename})};
+  const std::chrono::duration<double, std::milli> wall{
+      std::chrono::steady_clock::now() - startWall};
+  result.wallMs = wall.count();
+  return result;
+}
+
+// Runs the function in a child process, returning its pid and the read end of
+// a pipe it writes its result to.
+template <typename F>
+std::pair<pid_t, int> spawn(F &&function) {
+  // Otherwise the child writes out whatever the parent had buffered too.
+  std::fflush(stdout);
+  int fds[2];
+  if(pipe(fds)) {
+    std::perror("pipe");
+    std::exit(1);
+  }
+  const pid_t pid{fork()};
+  if(pid < 0) {
+    std::perror("fork");
+    std::exit(1);
+  }
+  if(!pid) {
+    close(fds[0]);
+    const Result result{function()};
+    Logger::flush();
+    std::fflush(stdout);
+    const ssize_t written{write(fds[1], &result, sizeof(result))};
+    _exit(written == sizeof(result) ? 0 : 1);
+  }
+  close(fds[1]);
+  return {pid, fds[0]};
+}
+
+std::vector<Config> expand(const std::vector<Sweep> &sweeps) {
+  std::vector<Config> configs{{"recorded", {}}};
+  if(sweeps.empty()) {
+    return configs;
+  }
+  std::vector<Config> swept{{"", {}}};
+  for(const Sweep &sweep : sweeps) {
+    std::vector<Config> next;
+    for(const Config &config : swept) {
+      for(const double value : sweep.values) {
+        Config expanded{config};
+        char label[64];
+        std::snprintf(label,
+                      sizeof(label),
+                      "%s%s=%g",
+                      config.label.empty() ? "" : " ",
+                      sweep.name.c_str(),
+                      value);
+        expanded.label += label;
+        if(sweep.name == "turnKP") {
+          expanded.tuning.turnKP = value;
+        } else if(sweep.name == "moveToKP") {
+          expanded.tuning.moveToKP = value;
+        } else if(sweep.name == "pathKP") {
+          expanded.tuning.pathKP = value;
+        } else {
+          expanded.tuning.lookahead = inch_t{value};
+        }
+        next.push_back(expanded);
+      }
+    }
+    swept = next;
+  }
+  configs.insert(configs.end(), swept.begin(), swept.end());
+  return configs;
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  std::string filename{"recording.bin"};
+  std::vector<Sweep> sweeps;
+  std::size_t jobs{std::max(1u, std::thread::hardware_concurrency())};
+  for(int i{1}; i < argc; i++) {
+    const std::string arg{argv[i]};
+    const std::size_t equals{arg.find('=')};
+    if(arg == "-j" && i + 1 < argc) {
+      jobs = std::max(1, std::atoi(argv[++i]));
+    } else if(equals == std::string::npos) {
+      filename = arg;
+    } else {
+      Sweep sweep{arg.substr(0, equals), {}};
+      if(sweep.name != "turnKP" && sweep.name != "moveToKP" &&
+         sweep.name != "pathKP" && sweep.name != "lookahead") {
+        std::fprintf(stderr, "Unknown parameter %s.\n", sweep.name.c_str());
+        return 1;
+      }
+      const char *values{argv[i] + equals + 1};
+      char *end;
+      while(*values) {
+        sweep.values.push_back(std::strtod(values, &end));
+        values = *end ? end + 1 : end;
+      }
+      sweeps.push_back(sweep);
+    }
+  }
+
+  if(!std::ifstream{filename}) {
+    std::printf("Recording %s...\n", filename.c_str());
+    const auto [pid, fd]{spawn([&filename]() {
+      record(filename);
+      return Result{};
+    })};
+    close(fd);
+    waitpid(pid, nullptr, 0);
+  }
+
+  const std::vector<Config> configs{expand(sweeps)};
+  std::vector<Result> results(configs.size());
+  std::vector<std::pair<pid_t, int>> running(configs.size(), {-1, -1});
+  const auto startWall{std::chrono::steady_clock::now()};
+  std::size_t started{0};
+  std::size_t finished{0};
+  while(finished < configs.size()) {
+    while(started < configs.size() && started - finished < jobs) {
+      const std::size_t index{started++};
+      running[index] = spawn([&filename, &configs, index]() {
+        return replay(filename, configs[index].tuning, index);
+      });
+    }
+    const pid_t pid{waitpid(-1, nullptr, 0)};
+    for(std::size_t i{0}; i < configs.size(); i++) {
+      if(running[i].first == pid) {
+        if(read(running[i].second, &results[i], sizeof(Result)) !=
+           sizeof(Result)) {
+          results[i] = {};
+        }
+        close(running[i].second);
+        running[i].first = -1;
+        finished++;
+      }
+    }
+  }
+  const std::chrono::duration<double, std::milli> wall{
+      std::chrono::steady_clock::now() - startWall};
+
+  const std::string title{"Replay of " + filename};
+  std::printf("%-36s %9s %10s %9s %9s %9s %9s\n",
+              title.c_str(),
+              "records",
+              "mismatched",
+              "first s",
+              "rms dV",
+              "max dV",
+              "wall ms");
+  for(std::size_t i{0}; i < configs.size(); i++) {
+    const Result &result{results[i]};
+    if(!result.loaded) {
+      std::printf("%-36s could not be replayed\n", configs[i].label.c_str());
+      continue;
+    }
+    char first[16]{"-"};
+    if(result.mismatched) {
+      std::snprintf(first, sizeof(first), "%.3f", result.firstMismatchS);
+    }
+    std::printf("%-36s %9zu %10zu %9s %9.3f %9.3f %9.1f\n",
+                configs[i].label.c_str(),
+                result.compared,
+                result.mismatched,
+                first,
+                result.rmsVoltageDifference,
+                result.maxVoltageDifference,
+                result.wallMs);
+  }
+  std::printf("%zu replays in %.1f ms on %zu jobs\n",
+              configs.size(),
+              wall.count(),
+              jobs);
+  return results.front().loaded && !results.front().mismatched ? 0 : 1;
+}
@@ -0,0 +1,311 @@
+/**
+ * @file sim.hpp
+ * @brief Includes the control interface for the host simulation backend, which
+ * stands in for the PROS kernel, V5 devices, and LVGL so atum can be built and
+ * ran on a desktop.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "pros/device.hpp"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace atum {
+namespace sim {
+/**
+ * @brief The smart port the brain's built in ADI ports are addressed through.
+ *
+ */
+constexpr std::uint8_t internalADIPort{22};
+
+/**
+ * @brief The period with which device models and steppers are advanced.
+ *
+ */
+constexpr std::uint64_t stepPeriodUs{1000};
+
+/**
+ * @brief Gets the simulated time since startup.
+ *
+ * Simulated time only advances while every task is delayed, so code between
+ * two delays takes no simulated time regardless of how long it takes on the
+ * host.
+ *
+ * @return std::uint64_t
+ */
+std::uint64_t now();
+
+/**
+ * @brief Adds a function that is called every simulated millisecond with the
+ * time step in seconds. Used to write physics models that feed the simulated
+ * devices.
+ *
+ * @param stepper
+ */
+void addStepper(const std::function<void(double)> &stepper);
+
+/**
+ * @brief Sets the competition status bits, as returned by
+ * pros::competition::get_status.
+ *
+ * @param status
+ */
+void setCompetitionStatus(const std::uint8_t status);
+
+/**
+ * @brief Marks a device of a given type as being plugged into a port. Motors
+ * and other devices constructed by the program plug themselves in, but devices
+ * atum looks for before constructing, like IMUs, must be plugged in manually.
+ *
+ * @param port
+ * @param type
+ */
+void plug(const std::uint8_t port, const pros::DeviceType type);
+
+/**
+ * @brief Unplugs whatever is on the given port.
+ *
+ * @param port
+ */
+void unplug(const std::uint8_t port);
+
+/**
+ * @brief Gets the type of device plugged into a port.
+ *
+ * @param port
+ * @return pros::DeviceType
+ */
+pros::DeviceType pluggedType(const std::uint8_t port);
+
+/**
+ * @brief The state of a simulated V5 motor. Positions are in degrees and
+ * velocities in RPM at the motor's output shaft, not accounting for its
+ * reversal.
+ *
+ */
+struct MotorState {
+  enum class Mode { Voltage, Velocity, Brake };
+  Mode mode{Mode::Voltage};
+  std::int32_t voltage{0};
+  std::int32_t targetVelocity{0};
+  std::int32_t gearset{1};
+  std::int32_t encoderUnits{0};
+  double maxVelocity{200.0};
+  double position{0.0};
+  double velocity{0.0};
+  // Time constant of the first order velocity response in seconds.
+  double timeConstant{0.05};
+  std::int32_t brakeMode{0};
+  std::int32_t currentLimit{2500};
+  double temperature{25.0};
+  std::uint64_t updatedUs{0};
+};
+
+/**
+ * @brief The state of a simulated V5 inertial sensor.
+ *
+ */
+struct IMUState {
+  double rotation{0.0};
+  std::uint64_t calibratedUs{0};
+};
+
+/**
+ * @brief The state of a simulated three wire quadrature encoder.
+ *
+ */
+struct EncoderState {
+  double ticks{0.0};
+  bool reversed{false};
+};
+
+/**
+ * @brief The state of a simulated three wire port used as anything other than
+ * an encoder.
+ *
+ */
+struct ADIState {
+  std::int32_t value{0};
+  std::int32_t config{0};
+  bool pressed{false};
+};
+
+/**
+ * @brief The state of a simulated V5 rotation sensor, in centidegrees.
+ *
+ */
+struct RotationState {
+  double position{0.0};
+  double velocity{0.0};
+  bool reversed{false};
+};
+
+/**
+ * @brief The state of a simulated V5 distance sensor, in millimeters.
+ *
+ */
+struct DistanceState {
+  std::int32_t distance{9999};
+  std::int32_t confidence{0};
+  std::int32_t objectSize{0};
+};
+
+/**
+ * @brief The state of a simulated V5 optical sensor.
+ *
+ */
+struct OpticalState {
+  double hue{0.0};
+  double saturation{0.0};
+  double brightness{0.0};
+  std::int32_t proximity{0};
+  std::int32_t ledPWM{0};
+};
+
+/**
+ * @brief The state of a simulated V5 GPS sensor, in meters and degrees.
+ *
+ */
+struct GPSState {
+  double x{0.0};
+  double y{0.0};
+  double heading{0.0};
+  double error{0.02};
+};
+
+/**
+ * @brief The state of a simulated controller.
+ *
+ */
+struct ControllerState {
+  std::int32_t analog[4]{};
+  std::uint32_t digital{0};
+  std::uint32_t previousDigital{0};
+  std::string text[3];
+  bool connected{true};
+};
+
+MotorState &motor(const std::uint8_t port);
+IMUState &imu(const std::uint8_t port);
+EncoderState &encoder(const std::uint8_t adiPort,
+                      const std::uint8_t smartPort = internalADIPort);
+ADIState &adi(const std::uint8_t adiPort,
+              const std::uint8_t smartPort = internalADIPort);
+RotationState &rotation(const std::uint8_t port);
+DistanceState &distance(const std::uint8_t port);
+OpticalState &optical(const std::uint8_t port);
+GPSState &gps(const std::uint8_t port);
+ControllerState &controller(const std::uint8_t id = 0);
+
+/**
+ * @brief Counters of the LVGL calls made, for measuring GUI cost.
+ *
+ */
+struct LVGLStats {
+  std::uint64_t objectsCreated{0};
+  std::uint64_t labelWrites{0};
+  std::uint64_t chartPoints{0};
+  std::uint64_t chartRefreshes{0};
+};
+
+/**
+ * @brief Gets the LVGL call counters.
+ *
+ * @return LVGLStats&
+ */
+LVGLStats &lvglStats();
+
+/**
+ * @brief Gets the text last written to an LVGL label.
+ *
+ * @param label
+ * @return std::string
+ */
+std::string labelText(const void *label);
+
+/**
+ * @brief Gets the total number of heap allocations made by the program.
+ *
+ * @return std::uint64_t
+ */
+std::uint64_t allocations();
+
+/**
+ * @brief A kinematic model of a differential drive that integrates the
+ * simulated drive motors into a field pose and writes the readings the
+ * robot's IMUs and tracking wheels would see.
+ *
+ * Poses follow atum's convention: heading is clockwise from the positive y
+ * axis, in radians here.
+ *
+ */
+class DifferentialDrive {
+  public:
+  /**
+   * @brief A tracking wheel on a three wire encoder.
+   *
+   */
+  struct Odometer {
+    std::uint8_t topPort{0};
+    // Circumference of the wheel in meters.
+    double circum{0.0};
+    // Offset from the center of rotation in meters, as given to atum.
+    double fromCenter{0.0};
+    bool reversed{false};
+    std::uint8_t smartPort{internalADIPort};
+  };
+
+  /**
+   * @brief The layout of the simulated drive.
+   *
+   */
+  struct Parameters {
+    // Motor ports with their directions, as given to atum::Motor.
+    std::vector<std::int8_t> left;
+    std::vector<std::int8_t> right;
+    // Motor revolutions per wheel revolution, as in atum::Motor::Gearing.
+    double ratio{1.0};
+    // Distance between the drive wheels in meters.
+    double track{0.3};
+    // Circumference of the drive wheels in meters.
+    double circum{0.26};
+    std::vector<std::uint8_t> imus;
+    Odometer forward{};
+    Odometer side{};
+  };
+
+  /**
+   * @brief Constructs a new DifferentialDrive and registers it as a stepper.
+   * Should outlive the simulation.
+   *
+   * @param iParams
+   */
+  DifferentialDrive(const Parameters &iParams);
+
+  /**
+   * @brief Advances the model by dt seconds.
+   *
+   * @param dt
+   */
+  void step(const double dt);
+
+  double x{0.0};
+  double y{0.0};
+  double h{0.0};
+  double v{0.0};
+  double omega{0.0};
+
+  private:
+  double sideVelocity(const std::vector<std::int8_t> &ports) const;
+
+  const Parameters params;
+};
+} // namespace sim
+} // namespace atum
@@ -0,0 +1,269 @@
+#include "fixture.hpp"
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Checks the behavior of atum's building blocks on the host, and exits with
+// the number of failed checks so a build can stop on them. Timings belong in
+// profile.cpp instead.
+
+using namespace atum;
+
+namespace {
+int checks{0};
+int failures{0};
+
+void check(const bool passed, const std::string &name) {
+  checks++;
+  if(!passed) {
+    failures++;
+    std::printf("FAIL: %s\n", name.c_str());
+  }
+}
+
+bool near(const double value, const double expected, const double tolerance) {
+  return std::abs(value - expected) <= tolerance;
+}
+
+// Counts how many times the text appears.
+int occurrences(const std::string &text, const std::string &part) {
+  int count{0};
+  for(std::size_t at{text.find(part)}; at != std::string::npos;
+      at = text.find(part, at + part.size())) {
+    count++;
+  }
+  return count;
+}
+
+// A tracker whose pose is only ever set, for checking what Tracker keeps.
+class SetTracker : public Tracker {
+  public:
+  SetTracker() : Tracker{Logger::Level::Warn} {}
+
+  Pose update() override {
+    return getPose();
+  }
+};
+
+void ringBufferTests() {
+  RingBuffer<int, 4> buffer;
+  check(buffer.empty(), "ring buffer starts empty");
+  bool pushed{true};
+  for(int i{1}; i <= 4; i++) {
+    pushed = buffer.push(i) && pushed;
+  }
+  check(pushed, "ring buffer takes as many values as its capacity");
+  check(!buffer.push(5), "ring buffer refuses values when full");
+  check(buffer.size() == 4, "ring buffer counts its values");
+  bool ordered{true};
+  int value{0};
+  for(int i{1}; i <= 4; i++) {
+    ordered = buffer.pop(value) && value == i && ordered;
+  }
+  check(ordered, "ring buffer pops values in the order pushed");
+  check(!buffer.pop(value), "ring buffer pops nothing when empty");
+  bool wrapped{true};
+  for(int i{0}; i < 10; i++) {
+    wrapped = buffer.push(i) && buffer.pop(value) && value == i && wrapped;
+  }
+  check(wrapped, "ring buffer keeps its order after wrapping around");
+}
+
+void snapshotTests() {
+  const Pose initial{1_in, 2_in, 3_deg};
+  Snapshot<Pose> snapshot{initial};
+  check(snapshot.load().x == initial.x && snapshot.load().h == initial.h,
+        "snapshot loads its initial value");
+  Pose stored{4_in, 5_in, 6_deg};
+  stored.v = meters_per_second_t{7.0};
+  for(int i{0}; i < 5; i++) {
+    stored.t = second_t{static_cast<double>(i)};
+    snapshot.store(stored);
+  }
+  const Pose loaded{snapshot.load()};
+  check(loaded.x == stored.x && loaded.y == stored.y && loaded.h == stored.h &&
+            loaded.v == stored.v && loaded.t == stored.t,
+        "snapshot loads the last value stored");
+}
+
+void trackerTests() {
+  SetTracker tracker;
+  tracker.setPose({0_in, 0_in, 170_deg});
+  const second_t start{tracker.getPose().t};
+  wait(100_ms);
+  tracker.setPose({10_in, 0_in, -170_deg});
+  const second_t end{tracker.getPose().t};
+  const Pose middle{tracker.getPose((start + end) / 2.0)};
+  check(near(getValueAs<inch_t>(middle.x), 5.0, 1e-6),
+        "tracker interpolates the position between poses");
+  check(near(getValueAs<degree_t>(constrain180(middle.h - 180_deg)), 0.0, 1e-6),
+        "tracker interpolates the heading the short way around");
+  check(near(getValueAs<inch_t>(tracker.getPose(start - 1_s).x), 0.0, 1e-9),
+        "tracker gives the oldest pose for times before it");
+  check(near(getValueAs<inch_t>(tracker.getPose(end + 1_s).x), 10.0, 1e-9),
+        "tracker gives the newest pose for times after it");
+
+  Pose measured{1_in, 2_in, 170_deg};
+  measured.t = start;
+  tracker.correctPose(measured);
+  const Pose corrected{tracker.getPose()};
+  check(near(getValueAs<inch_t>(corrected.x), 11.0, 1e-6) &&
+            near(getValueAs<inch_t>(corrected.y), 2.0, 1e-6),
+        "tracker moves the current pose by a late correction");
+  check(near(getValueAs<inch_t>(tracker.getPose(end).x), 11.0, 1e-6),
+        "tracker moves the poses kept since a late correction");
+}
+
+// Feeds a value accelerating at 2 per second squared, updated every 10 ms.
+void derivativeTests() {
+  constexpr double acceleration{2.0};
+  constexpr double dt{0.01};
+  auto follow = [](DerivativeEstimator &estimator) {
+    DerivativeEstimator::Estimate estimate;
+    double previous{0.0};
+    for(int i{1}; i <= 200; i++) {
+      const double value{acceleration * std::pow(i * dt, 2) / 2.0};
+      estimate = estimator.update(value - previous, second_t{dt});
+      previous = value;
+    }
+    return estimate;
+  };
+  constexpr double rate{acceleration * 200 * dt};
+  struct Case {
+    const char *name;
+    std::unique_ptr<DerivativeEstimator> estimator;
+    double rateTolerance;
+    double accelerationTolerance;
+  };
+  Case cases[]{
+      // Differencing gives the rate halfway through the last update.
+      {"FiniteDifference",
+       std::make_unique<FiniteDifference>(),
+       acceleration * dt / 2.0 + 1e-9,
+       1e-6},
+      {"SavitzkyGolay", std::make_unique<SavitzkyGolay>(), 1e-6, 1e-6},
+      {"AlphaBetaGamma", std::make_unique<AlphaBetaGamma>(), 0.01, 0.05},
+      {"KalmanDerivative", std::make_unique<KalmanDerivative>(), 0.01, 0.05}};
+  for(Case &test : cases) {
+    const std::string name{test.name};
+    const DerivativeEstimator::Estimate estimate{follow(*test.estimator)};
+    check(near(estimate.rate, rate, test.rateTolerance),
+          name + " follows the rate of a steady acceleration");
+    check(near(estimate.acceleration, acceleration, test.accelerationTolerance),
+          name + " follows a steady acceleration");
+    const DerivativeEstimator::Estimate still{
+        test.estimator->update(1.0, 0_s)};
+    check(still.rate == estimate.rate &&
+              still.acceleration == estimate.acceleration,
+          name + " ignores updates that take no time");
+    const std::unique_ptr<DerivativeEstimator> clone{test.estimator->clone()};
+    const DerivativeEstimator::Estimate cloned{clone->update(0.0, 10_ms)};
+    check(cloned.rate == 0.0 && cloned.acceleration == 0.0,
+          name + " clones start from rest");
+    test.estimator->reset();
+    const DerivativeEstimator::Estimate reset{
+        test.estimator->update(0.0, 10_ms)};
+    check(reset.rate == 0.0 && reset.acceleration == 0.0,
+          name + " starts from rest once reset");
+  }
+}
+
+// Runs an EKF on a robot that stays still, with a GPS read directly from the
+// simulated sensor. Updates are spaced out as in its task, so every pose kept
+// has its own time.
+void ekfTests() {
+  constexpr std::uint8_t gpsPort{16};
+  sim::plug(14, pros::DeviceType::imu);
+  sim::plug(gpsPort, pros::DeviceType::gps);
+  GPS gps{gpsPort, {}, 0.5, 1.0, Logger::Level::Off};
+  EKF ekf{std::make_unique<Odometer>(
+              'A', 'B', 203.724231788_mm, 0_in, false, Logger::Level::Off),
+          std::make_unique<Odometer>(
+              'C', 'D', 203.724231788_mm, 0_in, true, Logger::Level::Off),
+          std::make_unique<IMU>(PortsList{14}, false, Logger::Level::Off),
+          nullptr,
+          &gps,
+          EKF::Parameters{},
+          Logger::Level::Off};
+  ekf.setPose({0_in, 0_in, 0_deg});
+  const EKF::Covariance initial{ekf.getCovariance()};
+
+  sim::gps(gpsPort).x = getValueAs<meter_t>(20_in);
+  sim::gps(gpsPort).y = 0.0;
+  wait(Odometry::period);
+  ekf.update();
+  check(near(getValueAs<inch_t>(ekf.getPose().x), 0.0, 1e-9) &&
+            ekf.getCovariance()[0][0] == initial[0][0],
+        "EKF rejects GPS readings far outside its covariance");
+
+  sim::gps(gpsPort).x = getValueAs<meter_t>(1_in);
+  wait(Odometry::period);
+  ekf.update();
+  const double corrected{getValueAs<inch_t>(ekf.getPose().x)};
+  check(corrected > 0.0 && corrected < 1.0,
+        "EKF moves part way toward GPS readings within its covariance");
+  check(ekf.getCovariance()[0][0] < initial[0][0],
+        "EKF grows more certain with an accepted GPS reading");
+
+  wait(Odometry::period);
+  ekf.update();
+  check(near(getValueAs<inch_t>(ekf.getPose().x), corrected, 1e-9),
+        "EKF uses each GPS reading only once");
+
+  const EKF::Covariance before{ekf.getCovariance()};
+  Pose measured{ekf.getPose()};
+  measured.x += 3_in;
+  ekf.correctPose(measured);
+  check(near(getValueAs<inch_t>(ekf.getPose().x), corrected + 3.0, 1e-6),
+        "EKF takes a correction to its pose");
+  check(near(ekf.getCovariance()[0][0], before[0][0], 1e-9),
+        "EKF keeps its covariance through a correction");
+  wait(Odometry::period);
+  ekf.update();
+  check(near(getValueAs<inch_t>(ekf.getPose().x), corrected + 3.0, 1e-6),
+        "EKF keeps a correction through its next update");
+}
+
+// Logs at Warn, with what is printed captured instead of shown.
+void loggerTests() {
+  Logger::flush();
+  std::ostringstream captured;
+  std::streambuf *const console{std::cout.rdbuf(captured.rdbuf())};
+  Logger logger{Logger::Level::Warn};
+  const std::string repeated{"Motor on port 1 is hot."};
+  for(int i{0}; i < 5; i++) {
+    logger.warn(repeated);
+  }
+  // Below the logger's level, so these mustn't push the warning out of the
+  // table of recent messages.
+  for(int i{0}; i < 100; i++) {
+    logger.info("Motor on port " + std::to_string(i) + " is warm.");
+  }
+  logger.warn(repeated);
+  Logger::flush();
+  const std::string early{captured.str()};
+  wait(10100_ms);
+  logger.warn(repeated);
+  Logger::flush();
+  std::cout.rdbuf(console);
+  check(occurrences(early, repeated) == 1,
+        "logger suppresses repeats within the repeat window");
+  check(occurrences(early, "is warm") == 0,
+        "logger doesn't print messages below its level");
+  check(occurrences(captured.str(), repeated + " (suppressed 5 repeats)") == 1,
+        "logger reports how many repeats it suppressed");
+}
+} // namespace
+
+int main() {
+  ringBufferTests();
+  snapshotTests();
+  trackerTests();
+  derivativeTests();
+  ekfTests();
+  loggerTests();
+  std::printf("%d of %d checks failed\n", failures, checks);
+  return failures ? 1 : 0;
+}
@@ -1,10 +1,17 @@
 #include "controller.hpp"
 
 namespace atum {
-Controller::Controller(const Logger::Level loggerLevel) : logger{loggerLevel} {}
+Controller::Controller(const Logger::Level loggerLevel) :
+    logger{loggerLevel}, id{constructed++} {}
 
 double Controller::getOutput() {
-  logger.debug("Output of controller is " + std::to_string(output));
+  LOG_DEBUG(logger, "Output of controller is " + std::to_string(output));
+  Telemetry::record(telemetryChannel, id, lastError, output);
   return output;
 }
+
+std::uint16_t Controller::constructed{0};
+
+const Telemetry::Channel Controller::telemetryChannel{
+    Telemetry::addChannel("controller", {"id", "error", "output"})};
 } // namespace atum
\ No newline at end of file
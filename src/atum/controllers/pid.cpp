@@ -3,13 +3,14 @@
 namespace atum {
 PID::PID(const Parameters &iParams, const Logger::Level loggerLevel) :
     Controller{loggerLevel}, params{iParams} {
-  logger.debug("PID controller is constructed!");
+  LOG_DEBUG(logger, "PID controller is constructed!");
 };
 
 double PID::getOutput(const double error) {
   const double P{params.kP * error};
   const double D{params.kD * (error - prevError)};
   updateI(error); // Updates prevError as side effect, so must be after D.
+  lastError = error;
   if(params.ffScaling) {
     logger.warn("Feedforward scaling enabled, but not applied.");
   }
@@ -25,6 +26,7 @@ double PID::getOutput(const double state, const double reference) {
   updateI(error);
   const double D{params.kD * (prevState - state)};
   prevState = state;
+  lastError = error;
   if(params.ffScaling) {
     output = P + I + D + params.ff * reference;
   } else {
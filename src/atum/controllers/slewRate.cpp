@@ -8,7 +8,7 @@ SlewRate::SlewRate(const std::pair<double, double> &rates,
     incRate{std::abs(rates.second)},
     output{initialValue},
     logger{loggerLevel} {
-  logger.debug("Slew rate is constructed!");
+  LOG_DEBUG(logger, "Slew rate is constructed!");
 }
 
 SlewRate::SlewRate(const double rate,
@@ -29,7 +29,7 @@ double SlewRate::slew(const double desired) {
 }
 
 double SlewRate::getOutput() {
-  logger.debug("Output of slew rate is " + std::to_string(output));
+  LOG_DEBUG(logger, "Output of slew rate is " + std::to_string(output));
   return output;
 }
 } // namespace atum
\ No newline at end of file
@@ -3,10 +3,11 @@
 namespace atum {
 TBH::TBH(const Parameters &iParams, const Logger::Level loggerLevel) :
     Controller{loggerLevel}, params{iParams} {
-  logger.debug("TBH controller is constructed!");
+  LOG_DEBUG(logger, "TBH controller is constructed!");
 }
 
 double TBH::getOutput(const double error) {
+  lastError = error;
   output += error * params.kTBH;
   output =
       std::clamp(output, params.constraints.first, params.constraints.second);
@@ -4,8 +4,8 @@ namespace atum {
 ADIExtenderPort::ADIExtenderPort(const std::int8_t smartPort,
                                  const std::uint8_t adiPort,
                                  const Logger::Level loggerLevel) :
-    port{smartPort, adiPort}, logger{loggerLevel} {
-  pros::Device extender{smartPort};
+    port{static_cast<std::uint8_t>(smartPort), adiPort}, logger{loggerLevel} {
+  pros::Device extender{static_cast<std::uint8_t>(smartPort)};
   if(!extender.is_installed()) {
     logger.error("ADI extender at port " + std::to_string(extender.get_port()) +
                  " could not be initialized!");
@@ -27,8 +27,18 @@ ColorSensor::ColorSensor(const std::vector<HueField> iHueFields,
   initializeColorSensor();
 }
 
+ColorSensor::~ColorSensor() {
+  if(sampler) {
+    Executor::remove(sampler.value());
+  }
+}
+
 ColorSensor::Color ColorSensor::getColor() {
   tallyCount();
+  return detectColor();
+}
+
+ColorSensor::Color ColorSensor::detectColor() {
   if(colorSensor->get_proximity() < nearProximity) {
     return Color::None;
   }
@@ -54,7 +64,7 @@ int ColorSensor::tallyCount() {
 }
 
 int ColorSensor::getCount() {
-  logger.debug("Color sensor counts " + std::to_string(count) + ".");
+  LOG_DEBUG(logger, "Color sensor counts " + std::to_string(count) + ".");
   return count;
 }
 
@@ -65,7 +75,8 @@ void ColorSensor::resetCount() {
 double ColorSensor::getRawHue() {
   check();
   const double reading{colorSensor->get_hue()};
-  logger.debug("Color sensor hue reading is " + std::to_string(reading) + ".");
+  LOG_DEBUG(logger,
+            "Color sensor hue reading is " + std::to_string(reading) + ".");
   return reading;
 }
 
@@ -79,6 +90,24 @@ bool ColorSensor::check() {
   return installed;
 }
 
+const Signal &ColorSensor::getChangeSignal() {
+  std::scoped_lock lock{samplerMutex};
+  if(!sampler) {
+    sampledColor = detectColor();
+    sampler = Executor::add("Color Sensor Sampler",
+                            refreshRate,
+                            TASK_PRIORITY_DEFAULT,
+                            [this]() {
+                              const Color color{detectColor()};
+                              if(color != sampledColor) {
+                                sampledColor = color;
+                                changeSignal.raise();
+                              }
+                            });
+  }
+  return changeSignal;
+}
+
 void ColorSensor::initializeColorSensor() {
   // The abundance of delays in here is because of a seeming undocumented
   // "delay" needed for many of these values to be set.
@@ -24,8 +24,8 @@ DistanceSensor::DistanceSensor(const millimeter_t iThreshold,
   }
   distanceSensor =
       std::make_unique<pros::Distance>(distanceSensors.front().get_port());
-  logger.debug("Distance sensor found on port " +
-               std::to_string(distanceSensor->get_port()) + ".");
+  LOG_DEBUG(logger, "Distance sensor found on port " +
+                    std::to_string(distanceSensor->get_port()) + ".");
   logger.info("Distance sensor contructed with port " +
               std::to_string(distanceSensor->get_port()) + ".");
 }
@@ -34,9 +34,9 @@ millimeter_t DistanceSensor::getDistance() {
   check();
   const int32_t distance{distanceSensor->get_distance()};
   if(distance == noObjectDistance) {
-    logger.debug("Distance sensor cannot detect object.");
+    LOG_DEBUG(logger, "Distance sensor cannot detect object.");
   }
-  return millimeter_t{distance};
+  return millimeter_t{static_cast<double>(distance)};
 }
 
 bool DistanceSensor::closeTo() {
@@ -9,8 +9,8 @@ IMU::IMU(const PortsList &ports,
     pros::v5::Device device{port};
     if(device.get_plugged_type() == pros::DeviceType::imu) {
       imus.push_back(std::make_unique<pros::IMU>(port));
-      logger.debug("IMU found on port " + std::to_string(device.get_port()) +
-                   ".");
+      LOG_DEBUG(logger,
+                "IMU found on port " + std::to_string(device.get_port()) + ".");
     } else {
       logger.warn("IMU at port " + std::to_string(port) +
                   " could not be initialized!");
@@ -34,7 +34,8 @@ IMU::IMU(const std::size_t expectedAmount,
   }
   for(auto imu : rawIMUs) {
     imus.push_back(std::make_unique<pros::IMU>(imu.get_port()));
-    logger.debug("IMU found on port " + std::to_string(imu.get_port()) + ".");
+    LOG_DEBUG(logger,
+              "IMU found on port " + std::to_string(imu.get_port()) + ".");
   }
   initializeIMUs();
 }
@@ -47,24 +48,29 @@ void IMU::setHeading(degree_t heading) {
     imu->set_rotation(getValueAs<degree_t>(heading));
   }
   previous = heading;
-  logger.debug("IMU heading set to " + to_string(heading) + ".");
+  LOG_DEBUG(logger, "IMU heading set to " + to_string(heading) + ".");
 }
 
 degree_t IMU::getHeading() {
-  std::vector<degree_t> readings;
+  // Averaged as it goes, as odometry reads this every update.
+  degree_t sum{0_deg};
+  std::size_t count{0};
   for(auto &imu : imus) {
     if(imu->is_installed()) {
-      readings.push_back(degree_t{imu->get_rotation()});
+      const double rotation{imu->get_rotation()};
+      Telemetry::recordPrecise(telemetryChannel, imu->get_port(), rotation);
+      sum += degree_t{rotation};
+      count++;
     } else {
       logger.error("IMU on port " + std::to_string(imu->get_port()) +
                    " is not installed.");
     }
   }
-  degree_t heading{average(readings)};
+  degree_t heading{count ? sum / static_cast<double>(count) : 0_deg};
   if(reversed) {
     heading *= -1;
   }
-  logger.debug("IMU is reading " + to_string(heading) + ".");
+  LOG_DEBUG(logger, "IMU is reading " + to_string(heading) + ".");
   return heading;
 }
 
@@ -72,7 +78,8 @@ degree_t IMU::getTraveled() {
   const degree_t current{getHeading()};
   const degree_t dh{current - previous};
   previous = current;
-  logger.debug("IMU has traveled " + to_string(dh) + " since last called.");
+  LOG_DEBUG(logger,
+            "IMU has traveled " + to_string(dh) + " since last called.");
   return dh;
 }
 
@@ -92,4 +99,7 @@ void IMU::initializeIMUs() {
   }
   logger.info("IMU is calibrated!");
 }
+
+const Telemetry::Channel IMU::telemetryChannel{Telemetry::addChannel(
+    "imu", {"port", "rotation_deg"}, Telemetry::Precision::Double)};
 } // namespace atum
\ No newline at end of file
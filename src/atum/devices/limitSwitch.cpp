@@ -14,6 +14,12 @@ LimitSwitch::LimitSwitch(const ADIExtenderPort &port,
   wait(adiCalibrationTime);
 }
 
+LimitSwitch::~LimitSwitch() {
+  if(sampler) {
+    Executor::remove(sampler.value());
+  }
+}
+
 bool LimitSwitch::isPressed() {
   return limitSwitch.get_value();
 }
@@ -21,4 +27,22 @@ bool LimitSwitch::isPressed() {
 bool LimitSwitch::isNewlyPressed() {
   return limitSwitch.get_new_press();
 }
+
+const Signal &LimitSwitch::getChangeSignal() {
+  std::scoped_lock lock{samplerMutex};
+  if(!sampler) {
+    sampledPressed = isPressed();
+    sampler = Executor::add("Limit Switch Sampler",
+                            standardDelay,
+                            TASK_PRIORITY_DEFAULT,
+                            [this]() {
+                              const bool pressed{isPressed()};
+                              if(pressed != sampledPressed) {
+                                sampledPressed = pressed;
+                                changeSignal.raise();
+                              }
+                            });
+  }
+  return changeSignal;
+}
 } // namespace atum
\ No newline at end of file
@@ -22,7 +22,7 @@ bool LineTracker::triggered() {
 std::int32_t LineTracker::getReading() {
   check();
   const std::int32_t reading{lineTracker.get_value()};
-  logger.debug("Line tracker is reading " + std::to_string(reading) + ".");
+  LOG_DEBUG(logger, "Line tracker is reading " + std::to_string(reading) + ".");
   return reading;
 }
 
@@ -39,7 +39,7 @@ bool LineTracker::check() {
 void LineTracker::initializeLineTracker() {
   // Give time to calibrate the sensor to different lighting conditions.
   wait(adiCalibrationTime);
-  logger.debug("Line tracker has been constructed.");
+  LOG_DEBUG(logger, "Line tracker has been constructed.");
   lineTracker.get_value(); // Clear readings.
   wait(adiCalibrationTime);
   check();
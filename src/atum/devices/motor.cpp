@@ -12,10 +12,11 @@ Motor::Motor(const MotorPortsList &ports,
                                       gearing.cartridge,
                                       pros::v5::MotorEncoderUnits::degrees));
     enabled.push_back(true);
+    overheated.push_back(false);
     directions.push_back((port < 0) ? -1 : 1);
   }
   check();
-  logger.debug("The " + name + " motor is constructed!");
+  LOG_DEBUG(logger, "The " + name + " motor is constructed!");
 }
 
 void Motor::moveVelocity(const revolutions_per_minute_t velocity) {
@@ -31,10 +32,17 @@ void Motor::moveVelocity(const revolutions_per_minute_t velocity) {
 
 void Motor::moveVoltage(double voltage) {
   check();
-  voltage *= 1000;
+  const bool recording{Telemetry::isRecording()};
   for(std::size_t i{0}; i < motors.size(); i++) {
     if(enabled[i]) {
-      motors[i]->move_voltage(directions[i] * voltage);
+      motors[i]->move_voltage(directions[i] * voltage * 1000);
+      if(recording) {
+        Telemetry::record(telemetryChannel,
+                          motors[i]->get_port(),
+                          directions[i] * voltage,
+                          directions[i] * motors[i]->get_actual_velocity(),
+                          motors[i]->get_current_draw());
+      }
     }
   }
 }
@@ -49,19 +57,31 @@ void Motor::brake() {
 }
 
 degree_t Motor::getPosition() const {
-  std::vector<degree_t> positions;
+  // Averaged as it goes, as odometry reads this every update.
+  degree_t sum{0_deg};
+  std::size_t count{0};
+  const bool recording{Telemetry::isRecording()};
   for(std::size_t i{0}; i < motors.size(); i++) {
     if(enabled[i]) {
-      positions.push_back(degree_t{directions[i] * motors[i]->get_position()});
+      if(recording) {
+        recordReadings(i);
+      }
+      sum += degree_t{directions[i] * motors[i]->get_position()};
+      count++;
     }
   }
-  return offset + average(positions) / gearing.ratio;
+  const degree_t position{count ? sum / static_cast<double>(count) : 0_deg};
+  return offset + position / gearing.ratio;
 }
 
 revolutions_per_minute_t Motor::getVelocity() const {
   std::vector<revolutions_per_minute_t> velocities;
+  const bool recording{Telemetry::isRecording()};
   for(std::size_t i{0}; i < motors.size(); i++) {
     if(enabled[i]) {
+      if(recording) {
+        recordReadings(i);
+      }
       const revolutions_per_minute_t velocity{directions[i] *
                                               motors[i]->get_actual_velocity()};
       velocities.push_back(velocity);
@@ -75,7 +95,7 @@ revolutions_per_minute_t Motor::getTargetVelocity() const {
     if(enabled[i]) {
       const std::int32_t targetVelocity{directions[i] *
                                         motors[0]->get_target_velocity()};
-      return revolutions_per_minute_t{targetVelocity};
+      return revolutions_per_minute_t{static_cast<double>(targetVelocity)};
     }
   }
   // Just suppresses warning, if this happens we're in deep anyway.
@@ -202,19 +222,48 @@ Motor::Gearing Motor::getGearing() const {
 
 bool Motor::check() {
   bool goodEnough{true};
-  for(int i{0}; i < motors.size(); i++) {
+  for(std::size_t i{0}; i < motors.size(); i++) {
     std::int8_t port{motors[i]->get_port()};
+    const bool wasEnabled{static_cast<bool>(enabled[i])};
     enabled[i] = motors[i]->is_installed();
     goodEnough = goodEnough && enabled[i];
+    // Counted when they happen rather than on every check.
+    if(wasEnabled && !enabled[i]) {
+      disconnects.add();
+    }
+    const bool wasOverheated{static_cast<bool>(overheated[i])};
+    overheated[i] = enabled[i] && motors[i]->is_over_temp();
+    if(!wasOverheated && overheated[i]) {
+      overheats.add();
+    }
     if(!enabled[i]) {
       logger.error("The " + getName(port) + " motor is not installed.");
-    } else if(motors[i]->is_over_temp()) {
+    } else if(overheated[i]) {
       logger.warn("The " + getName(port) + " motor is overheating.");
     }
   }
   return goodEnough;
 }
 
+void Motor::recordReadings(const std::size_t i) const {
+  Telemetry::recordPrecise(readingsChannel,
+                           motors[i]->get_port(),
+                           motors[i]->get_position(),
+                           motors[i]->get_actual_velocity());
+}
+
+const Telemetry::Channel Motor::telemetryChannel{Telemetry::addChannel(
+    "motor", {"port", "voltage_v", "velocity_rpm", "current_ma"})};
+
+const Telemetry::Channel Motor::readingsChannel{
+    Telemetry::addChannel("motor readings",
+                          {"port", "position_deg", "velocity_rpm"},
+                          Telemetry::Precision::Double)};
+
+Metrics::Counter Motor::disconnects{"motor disconnects"};
+
+Metrics::Counter Motor::overheats{"motor overheats"};
+
 std::string Motor::getName(const std::int8_t port) {
   if(name.empty()) {
     return "port " + std::to_string(port);
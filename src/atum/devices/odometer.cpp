@@ -12,8 +12,8 @@ Odometer::Odometer(const std::uint8_t topPort,
     fromCenter{iFromCenter},
     logger{loggerLevel} {
   encoder.reset(); // Clear readings. 
-  logger.debug("Odometer on ports " + std::to_string(topPort) + " and " +
-               std::to_string(botPort) + " has been constructed.");
+  LOG_DEBUG(logger, "Odometer on ports " + std::to_string(topPort) + " and " +
+                    std::to_string(botPort) + " has been constructed.");
 }
 
 inch_t Odometer::traveled() {
@@ -29,10 +29,19 @@ inch_t Odometer::getFromCenter() const {
 
 int32_t Odometer::getTicks() {
   const int32_t ticks{encoder.get_value()};
-  logger.debug("Odometer on ports " +
-               std::to_string(get<1>(encoder.get_port())) + " and " +
-               std::to_string(get<2>(encoder.get_port())) + " reads " +
-               std::to_string(ticks) + ".");
+  Telemetry::recordPrecise(telemetryChannel,
+                           get<0>(encoder.get_port()),
+                           get<1>(encoder.get_port()),
+                           ticks);
+  LOG_DEBUG(logger, "Odometer on ports " +
+                    std::to_string(get<1>(encoder.get_port())) + " and " +
+                    std::to_string(get<2>(encoder.get_port())) + " reads " +
+                    std::to_string(ticks) + ".");
   return ticks;
 }
+
+const Telemetry::Channel Odometer::telemetryChannel{
+    Telemetry::addChannel("encoder",
+                          {"smart_port", "adi_port", "ticks"},
+                          Telemetry::Precision::Double)};
 } // namespace atum
\ No newline at end of file
@@ -8,9 +8,9 @@ Piston::Piston(const std::uint8_t port,
     piston{port, iReversed ? !startExtended : startExtended},
     reversed{iReversed},
     logger{loggerLevel} {
-  logger.debug("Piston on port " +
-               std::to_string(std::get<1>(piston.get_port())) +
-               " has been constructed.");
+  LOG_DEBUG(logger, "Piston on port " +
+                    std::to_string(std::get<1>(piston.get_port())) +
+                    " has been constructed.");
 }
 
 Piston::Piston(const ADIExtenderPort &port,
@@ -20,9 +20,9 @@ Piston::Piston(const ADIExtenderPort &port,
     piston{port(), iReversed ? !startExtended : startExtended},
     reversed{iReversed},
     logger{loggerLevel} {
-  logger.debug("Piston on port " +
-               std::to_string(std::get<1>(piston.get_port())) +
-               " has been constructed.");
+  LOG_DEBUG(logger, "Piston on port " +
+                    std::to_string(std::get<1>(piston.get_port())) +
+                    " has been constructed.");
 }
 
 void Piston::extend() {
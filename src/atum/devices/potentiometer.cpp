@@ -20,11 +20,12 @@ Potentiometer::Potentiometer(const ADIExtenderPort &port,
 }
 
 int32_t Potentiometer::getReading() {
-  double reading{pot.get_value_calibrated()};
+  double reading{static_cast<double>(pot.get_value_calibrated())};
   if(reversed) {
     reading *= -1;
   }
-  logger.debug("Potentiometer is reading " + std::to_string(reading) + ".");
+  LOG_DEBUG(logger,
+            "Potentiometer is reading " + std::to_string(reading) + ".");
   return reading;
 }
 
@@ -32,6 +33,6 @@ void Potentiometer::calibrate() {
   pot.calibrate();
   // Give time to calibrate the sensor.
   wait(adiCalibrationTime);
-  logger.debug("Potentiometer has been constructed.");
+  LOG_DEBUG(logger, "Potentiometer has been constructed.");
 }
 } // namespace atum
\ No newline at end of file
@@ -23,8 +23,8 @@ RotationSensor::RotationSensor(const bool reversed,
   }
   rotationSensor =
       std::make_unique<pros::Rotation>(rotationSensors.front().get_port());
-  logger.debug("Rotation sensor found on port " +
-               std::to_string(rotationSensor->get_port()) + ".");
+  LOG_DEBUG(logger, "Rotation sensor found on port " +
+                    std::to_string(rotationSensor->get_port()) + ".");
   initializeRotationSensor(reversed);
 }
 
@@ -32,7 +32,7 @@ degree_t RotationSensor::getPosition() {
   check();
   const degree_t reading{rotationSensor->get_angle() / 100.0};
   const degree_t value{offset + reading};
-  logger.debug("Rotation sensor position is: " + to_string(value));
+  LOG_DEBUG(logger, "Rotation sensor position is: " + to_string(value));
   return value;
 }
 
@@ -40,15 +40,15 @@ degree_t RotationSensor::getDisplacement() {
   check();
   const degree_t reading{rotationSensor->get_position() / 100.0};
   const degree_t value{offset + reading};
-  logger.debug("Rotation sensor displacement is: " + to_string(value));
+  LOG_DEBUG(logger, "Rotation sensor displacement is: " + to_string(value));
   return value;
 }
 
 degrees_per_second_t RotationSensor::getVelocity() {
   check();
-  const double reading{rotationSensor->get_velocity()};
+  const double reading{static_cast<double>(rotationSensor->get_velocity())};
   const degrees_per_second_t value{reading};
-  logger.debug("Rotation sensor velocity is: " + to_string(value));
+  LOG_DEBUG(logger, "Rotation sensor velocity is: " + to_string(value));
   return value;
 }
 
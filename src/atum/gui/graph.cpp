@@ -1,4 +1,5 @@
 #include "graph.hpp"
+#include "../time/executor.hpp"
 
 namespace atum {
 namespace GUI {
@@ -9,14 +10,14 @@ void Graph::addValue(double value, const SeriesColor seriesColor) {
   if(pros::competition::is_disabled()) {
     return;
   }
-  lv_chart_series_t *series{graphSeries[seriesColor]};
   const SeriesRange range{graphSeriesRanges[seriesColor]};
   const double absMin{std::abs(range.minimum)};
   value = absMin + std::clamp(value, range.minimum, range.maximum);
   const double rangeSum{absMin + std::abs(range.maximum)};
   value = value / rangeSum * 2 * graphResolution - graphResolution;
-  lv_chart_set_next_value(graphChart, series, static_cast<lv_coord_t>(value));
-  lv_chart_refresh(graphChart);
+  pending.push({static_cast<std::uint8_t>(seriesColor),
+                false,
+                static_cast<lv_coord_t>(value)});
 }
 
 void Graph::setSeriesRange(const SeriesRange &range,
@@ -30,8 +31,7 @@ void Graph::setSeriesRange(double range, const SeriesColor seriesColor) {
 }
 
 void Graph::clearSeries(const SeriesColor seriesColor) {
-  lv_chart_series_t *series{graphSeries[seriesColor]};
-  lv_chart_set_all_value(graphChart, series, LV_CHART_POINT_NONE);
+  pending.push({static_cast<std::uint8_t>(seriesColor), true, 0});
 }
 
 void Graph::clearAll() {
@@ -44,6 +44,58 @@ void Graph::clearAll() {
   clearSeries(SeriesColor::White);
 }
 
+void Graph::render() {
+  bool changed{false};
+  std::array<bool, 7> added{};
+  Command command;
+  while(pending.pop(command)) {
+    changed = true;
+    lv_chart_series_t *series{graphSeries[command.series]};
+    Bucket &bucket{buckets[command.series]};
+    if(command.clear) {
+      lv_chart_set_all_value(graphChart, series, LV_CHART_POINT_NONE);
+      bucket = {};
+      continue;
+    }
+    if(!bucket.count || command.value < bucket.minimum) {
+      bucket.minimum = command.value;
+      bucket.minimumAt = bucket.count;
+    }
+    if(!bucket.count || command.value > bucket.maximum) {
+      bucket.maximum = command.value;
+      bucket.maximumAt = bucket.count;
+    }
+    added[command.series] = true;
+    if(++bucket.count == samplesPerBucket) {
+      flush(command.series);
+    }
+  }
+  for(std::size_t series{0}; series < buckets.size(); series++) {
+    if(!added[series] && buckets[series].count) {
+      changed = true;
+      flush(series);
+    }
+  }
+  if(changed) {
+    lv_chart_refresh(graphChart);
+  }
+}
+
+void Graph::flush(const std::size_t series) {
+  Bucket &bucket{buckets[series]};
+  const bool minimumFirst{bucket.minimumAt <= bucket.maximumAt};
+  lv_chart_set_next_value(graphChart,
+                          graphSeries[series],
+                          minimumFirst ? bucket.minimum : bucket.maximum);
+  // A single value has nothing to span, so it is only drawn once.
+  if(bucket.count > 1) {
+    lv_chart_set_next_value(graphChart,
+                            graphSeries[series],
+                            minimumFirst ? bucket.maximum : bucket.minimum);
+  }
+  bucket = {};
+}
+
 void Graph::setupScreen() {
   createLabel(graphScreen,
               "GRAPH",
@@ -82,6 +134,11 @@ void Graph::setupScreen() {
       lv_chart_add_series(graphChart, yellow, LV_CHART_AXIS_PRIMARY_Y);
   graphSeries[SeriesColor::White] =
       lv_chart_add_series(graphChart, white, LV_CHART_AXIS_PRIMARY_Y);
+
+  Executor::add("Graph Screen",
+                millisecond_t{LV_DISP_DEF_REFR_PERIOD},
+                TASK_PRIORITY_MIN + 1,
+                render);
 }
 
 lv_obj_t *Graph::graphChart;
@@ -94,5 +151,7 @@ std::array<Graph::SeriesRange, 7> Graph::graphSeriesRanges{
     Graph::SeriesRange{graphResolution, graphResolution},
     Graph::SeriesRange{graphResolution, graphResolution},
     Graph::SeriesRange{graphResolution, graphResolution}};
+RingBuffer<Graph::Command, 512> Graph::pending;
+std::array<Graph::Bucket, 7> Graph::buckets;
 } // namespace GUI
 } // namespace atum
\ No newline at end of file
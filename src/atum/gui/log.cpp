@@ -1,18 +1,38 @@
 #include "log.hpp"
+#include "../time/executor.hpp"
+#include <algorithm>
+#include <mutex>
 
 namespace atum {
 namespace GUI {
-const std::size_t Log::maxLogLines{100};
+void Log::write(std::string_view msg) {
+  if(!msg.empty() && msg.back() == '\n') {
+    msg.remove_suffix(1);
+  }
+  const std::size_t length{std::min(msg.size(), maxLineLength - 1)};
+  std::scoped_lock lock{linesMutex};
+  std::array<char, maxLineLength> &line{lines[written % maxLogLines]};
+  std::copy_n(msg.begin(), length, line.begin());
+  line[length] = '\0';
+  written++;
+}
 
-void Log::write(const std::string &msg) {
-  std::string logText{lv_label_get_text(logTextLabel)};
-  if(logLines >= maxLogLines) {
-    logText.erase(0, logText.find('\n') + 1);
-  } else {
-    logLines++;
+void Log::refresh() {
+  std::scoped_lock lock{linesMutex};
+  // Lines overwritten before they were ever shown are skipped.
+  const std::size_t oldest{written > maxLogLines ? written - maxLogLines : 0};
+  for(std::size_t i{std::max(shown, oldest)}; i < written; i++) {
+    lv_obj_t *&label{lineLabels[i % maxLogLines]};
+    if(!label) {
+      label = lv_label_create(logTextBackground);
+      lv_obj_set_style_text_color(label, black, LV_STATE_DEFAULT);
+    } else {
+      // Held the oldest line, so becomes the newest at the bottom.
+      lv_obj_move_to_index(label, -1);
+    }
+    lv_label_set_text(label, lines[i % maxLogLines].data());
   }
-  logText += msg + '\n';
-  lv_label_set_text(logTextLabel, logText.c_str());
+  shown = written;
 }
 
 void Log::setupScreen() {
@@ -30,7 +50,7 @@ void Log::setupScreen() {
       mainMenuScreen,
       {&leftBorder});
 
-  lv_obj_t *logTextBackground = lv_obj_create(logScreen);
+  logTextBackground = lv_obj_create(logScreen);
   lv_obj_align(logTextBackground, LV_ALIGN_TOP_MID, 0, contentYOffset);
   lv_obj_set_size(logTextBackground, fillWidth, fillHeight);
   lv_obj_set_style_bg_color(logTextBackground, lightGrey, LV_STATE_DEFAULT);
@@ -39,15 +59,24 @@ void Log::setupScreen() {
       logTextBackground, white, LV_STATE_DEFAULT | LV_PART_SCROLLBAR);
   lv_obj_set_scrollbar_mode(logTextBackground, LV_SCROLLBAR_MODE_ACTIVE);
   lv_obj_set_scroll_dir(logTextBackground, LV_DIR_VER);
+  // Stacks the line labels in the order of their children.
+  lv_obj_set_flex_flow(logTextBackground, LV_FLEX_FLOW_COLUMN);
 
-  logTextLabel = lv_label_create(logTextBackground);
-  lv_label_set_text(logTextLabel, ""); // Clear default text.
-  lv_obj_align(logTextLabel, LV_ALIGN_TOP_LEFT, 0, 0);
-  lv_obj_set_style_text_color(logTextLabel, black, LV_STATE_DEFAULT);
+  Executor::add("Log Screen",
+                millisecond_t{LV_DISP_DEF_REFR_PERIOD},
+                TASK_PRIORITY_MIN + 1,
+                []() {
+                  if(lv_scr_act() == logScreen) {
+                    refresh();
+                  }
+                });
 }
 
-lv_obj_t *Log::logTextLabel;
-std::string Log::logText;
-std::size_t Log::logLines;
+lv_obj_t *Log::logTextBackground;
+std::array<std::array<char, Log::maxLineLength>, Log::maxLogLines> Log::lines;
+std::array<lv_obj_t *, Log::maxLogLines> Log::lineLabels;
+std::size_t Log::written;
+std::size_t Log::shown;
+pros::Mutex Log::linesMutex;
 } // namespace GUI
-} // namespace atum
\ No newline at end of file
+} // namespace atum
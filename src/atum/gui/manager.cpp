@@ -12,6 +12,7 @@ void Manager::initialize() {
   homeScreenSetup();
   mainMenuScreenSetup();
   Log::setupScreen();
+  Stats::setupScreen();
   Graph::setupScreen();
   Map::setupScreen();
 }
@@ -88,12 +89,21 @@ void Manager::mainMenuScreenSetup() {
                            {0, contentYOffset, LV_ALIGN_TOP_MID},
                            routinesScreen);
 
-  createScreenChangeButton(
-      mainMenuScreen,
-      "LOG",
-      {fillWidth, defaultHeight},
-      {0, contentYOffset + defaultHeight + defaultPadding, LV_ALIGN_TOP_MID},
-      logScreen);
+  createScreenChangeButton(mainMenuScreen,
+                           "LOG",
+                           {(fillWidth - defaultPadding) / 2, defaultHeight},
+                           {-(fillWidth + defaultPadding) / 4,
+                            contentYOffset + defaultHeight + defaultPadding,
+                            LV_ALIGN_TOP_MID},
+                           logScreen);
+
+  createScreenChangeButton(mainMenuScreen,
+                           "STATS",
+                           {(fillWidth - defaultPadding) / 2, defaultHeight},
+                           {(fillWidth + defaultPadding) / 4,
+                            contentYOffset + defaultHeight + defaultPadding,
+                            LV_ALIGN_TOP_MID},
+                           statsScreen);
 
   createScreenChangeButton(
       mainMenuScreen,
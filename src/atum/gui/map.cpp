@@ -1,8 +1,10 @@
 #include "map.hpp"
+#include "../time/executor.hpp"
 
 namespace atum {
 namespace GUI {
 const int Map::mapResolution{6000};
+const int Map::mapChartSize{screenHeight - 4 * defaultPadding};
 
 void Map::addPositions(const std::vector<Pose> &positions,
                        const SeriesColor seriesColor) {
@@ -12,21 +14,45 @@ void Map::addPositions(const std::vector<Pose> &positions,
 }
 
 void Map::addPosition(const Pose position, const SeriesColor seriesColor) {
-  lv_chart_series_t *series{mapSeries[seriesColor]};
   // From 12 in for the 6 ft in either direction from the origin.
   const int maxPossibleCoordinate{72};
   const int coordAdjustment{mapResolution / maxPossibleCoordinate};
-  const lv_coord_t x{getValueAs<inch_t, lv_coord_t>(position.x) *
-                     coordAdjustment};
-  const lv_coord_t y{getValueAs<inch_t, lv_coord_t>(position.y) *
-                     coordAdjustment};
-  lv_chart_set_next_value2(mapChart, series, x, y);
-  lv_chart_refresh(mapChart);
+  const lv_coord_t x{static_cast<lv_coord_t>(
+      getValueAs<inch_t, lv_coord_t>(position.x) * coordAdjustment)};
+  const lv_coord_t y{static_cast<lv_coord_t>(
+      getValueAs<inch_t, lv_coord_t>(position.y) * coordAdjustment)};
+  pending.push({static_cast<std::uint8_t>(seriesColor), false, x, y});
 }
 
 void Map::clearSeries(const SeriesColor seriesColor) {
-  lv_chart_series_t *series{mapSeries[seriesColor]};
-  lv_chart_set_all_value(mapChart, series, LV_CHART_POINT_NONE);
+  pending.push({static_cast<std::uint8_t>(seriesColor), true, 0, 0});
+}
+
+void Map::render() {
+  bool changed{false};
+  Command command;
+  while(pending.pop(command)) {
+    lv_chart_series_t *series{mapSeries[command.series]};
+    Pixel &last{lastPixels[command.series]};
+    if(command.clear) {
+      lv_chart_set_all_value(mapChart, series, LV_CHART_POINT_NONE);
+      last = {};
+      changed = true;
+      continue;
+    }
+    const Pixel pixel{true,
+                      command.x * mapChartSize / (2 * mapResolution),
+                      command.y * mapChartSize / (2 * mapResolution)};
+    if(last.drawn && pixel.x == last.x && pixel.y == last.y) {
+      continue;
+    }
+    lv_chart_set_next_value2(mapChart, series, command.x, command.y);
+    last = pixel;
+    changed = true;
+  }
+  if(changed) {
+    lv_chart_refresh(mapChart);
+  }
 }
 
 void Map::setupScreen() {
@@ -50,7 +76,6 @@ void Map::setupScreen() {
 
   mapChart = lv_chart_create(mapScreen);
   lv_chart_set_type(mapChart, LV_CHART_TYPE_SCATTER);
-  static const int mapChartSize{screenHeight - 4 * defaultPadding};
   lv_obj_set_size(mapChart, mapChartSize, mapChartSize);
   lv_obj_align(mapChart, LV_ALIGN_TOP_LEFT, 6 * defaultPadding, defaultPadding);
   lv_chart_set_range(
@@ -80,9 +105,16 @@ void Map::setupScreen() {
       lv_chart_add_series(mapChart, yellow, LV_CHART_AXIS_PRIMARY_Y);
   mapSeries[SeriesColor::White] =
       lv_chart_add_series(mapChart, white, LV_CHART_AXIS_PRIMARY_Y);
+
+  Executor::add("Map Screen",
+                millisecond_t{LV_DISP_DEF_REFR_PERIOD},
+                TASK_PRIORITY_MIN + 1,
+                render);
 }
 
 lv_obj_t *Map::mapChart;
 std::array<lv_chart_series_t *, 7> Map::mapSeries;
+RingBuffer<Map::Command, 512> Map::pending;
+std::array<Map::Pixel, 7> Map::lastPixels;
 } // namespace GUI
 } // namespace atum
\ No newline at end of file
@@ -48,6 +48,8 @@ void Screen::createScreens() {
   lv_obj_add_style(routinesScreen, &styleBG, 0);
   logScreen = lv_obj_create(nullptr);
   lv_obj_add_style(logScreen, &styleBG, 0);
+  statsScreen = lv_obj_create(nullptr);
+  lv_obj_add_style(statsScreen, &styleBG, 0);
   graphScreen = lv_obj_create(nullptr);
   lv_obj_add_style(graphScreen, &styleBG, 0);
   mapScreen = lv_obj_create(nullptr);
@@ -199,6 +201,7 @@ lv_obj_t *Screen::mainMenuScreen;
 lv_obj_t *Screen::homeScreen;
 lv_obj_t *Screen::routinesScreen;
 lv_obj_t *Screen::logScreen;
+lv_obj_t *Screen::statsScreen;
 lv_obj_t *Screen::graphScreen;
 lv_obj_t *Screen::mapScreen;
 } // namespace GUI
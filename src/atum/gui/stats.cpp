@@ -0,0 +1,55 @@
+#include "stats.hpp"
+#include "../time/executor.hpp"
+#include "../utility/metrics.hpp"
+
+namespace atum {
+namespace GUI {
+void Stats::refresh() {
+  std::string statsText;
+  for(const Metrics::Reading &reading : Metrics::snapshot()) {
+    statsText += Metrics::toString(reading) + '\n';
+  }
+  lv_label_set_text(statsTextLabel, statsText.c_str());
+}
+
+void Stats::setupScreen() {
+  createLabel(statsScreen,
+              "STATS",
+              {250, defaultHeight},
+              {defaultPadding, defaultPadding},
+              {&rightBorder, &styleTitle});
+
+  createScreenChangeButton(
+      statsScreen,
+      LV_SYMBOL_NEW_LINE,
+      {150, defaultHeight},
+      {-defaultPadding, defaultPadding, LV_ALIGN_TOP_RIGHT},
+      mainMenuScreen,
+      {&leftBorder});
+
+  lv_obj_t *statsTextBackground = lv_obj_create(statsScreen);
+  lv_obj_align(statsTextBackground, LV_ALIGN_TOP_MID, 0, contentYOffset);
+  lv_obj_set_size(statsTextBackground, fillWidth, fillHeight);
+  lv_obj_set_style_bg_color(statsTextBackground, lightGrey, LV_STATE_DEFAULT);
+  lv_obj_set_style_bg_opa(statsTextBackground, LV_OPA_COVER, LV_STATE_DEFAULT);
+  lv_obj_set_style_bg_color(
+      statsTextBackground, white, LV_STATE_DEFAULT | LV_PART_SCROLLBAR);
+  lv_obj_set_scrollbar_mode(statsTextBackground, LV_SCROLLBAR_MODE_ACTIVE);
+  lv_obj_set_scroll_dir(statsTextBackground, LV_DIR_VER);
+
+  statsTextLabel = lv_label_create(statsTextBackground);
+  lv_label_set_text(statsTextLabel, ""); // Clear default text.
+  lv_obj_align(statsTextLabel, LV_ALIGN_TOP_LEFT, 0, 0);
+  lv_obj_set_style_text_color(statsTextLabel, black, LV_STATE_DEFAULT);
+
+  // Snapshots allocate, so skip them unless someone is looking.
+  Executor::add("Stats Screen", 500_ms, TASK_PRIORITY_MIN + 1, []() {
+    if(lv_scr_act() == statsScreen) {
+      refresh();
+    }
+  });
+}
+
+lv_obj_t *Stats::statsTextLabel;
+} // namespace GUI
+} // namespace atum
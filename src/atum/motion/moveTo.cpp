@@ -30,16 +30,20 @@ void MoveTo::reverse(Pose target,
 void MoveTo::moveToPoint(Pose target,
                          const LateralProfile::Parameters &specialParams,
                          const bool reversed) {
-                          interrupted = false;
+  if(!start()) {
+    LOG_DEBUG(logger, "Move to was cancelled before it started.");
+    return;
+  }
   directionController->reset();
   if(flipped) {
     target.flip();
   }
-  logger.debug("Moving to " + toString(target) + ".");
+  LOG_DEBUG(logger, "Moving to " + toString(target) + ".");
   const Pose initialPose{drive->getPose()};
   const degree_t linearH{angle(initialPose, target)};
   follower->startProfile(0_m, distance(initialPose, target), specialParams);
-  while(!follower->isDone() && !interrupted) {
+  rate.reset();
+  while(!follower->isDone() && !isInterrupted()) {
     const Pose pose{drive->getPose()};
     const meters_per_second_t v{abs(drive->getVelocity())};
     const meter_t traveled{distance(initialPose, pose)};
@@ -54,14 +58,13 @@ void MoveTo::moveToPoint(Pose target,
     const double hError{getValueAs<degree_t>(constrain180(targetH - pose.h))};
     const double directionOutput{directionController->getOutput(hError)};
     drive->arcade(moveOutput, directionOutput);
-    wait();
+    rate.wait();
   }
   drive->brake();
-  if(interrupted) {
-    logger.debug("Move to was interrupted!");
-    interrupted = false;
+  if(finish()) {
+    LOG_DEBUG(logger, "Move to was interrupted!");
   } else {
-    logger.debug("Move to complete!");
+    LOG_DEBUG(logger, "Move to complete!");
   }
 }
 } // namespace atum
\ No newline at end of file
@@ -2,12 +2,75 @@
 
 namespace atum {
 void Movement::interrupt() {
-  interrupted = true;
+  std::scoped_lock lock{claimMutex};
+  if(token) {
+    *token = true;
+  }
+}
+
+Coroutine Movement::async(const std::function<void()> motion) {
+  // Claimed on the motion's task with the routine's own token, so a cancel
+  // that comes before the task gets going isn't lost.
+  auto routineToken = std::make_shared<std::atomic<bool>>(false);
+  return atum::async(
+      [this, motion, routineToken]() {
+        if(claim(routineToken)) {
+          motion();
+          finish();
+        }
+      },
+      [routineToken]() { *routineToken = true; });
 }
 
 void Movement::setFlipped(const bool iFlipped) {
   flipped = iFlipped;
 }
 
+const Rate &Movement::getRate() const {
+  return rate;
+}
+
+bool Movement::start() {
+  return claim(std::make_shared<std::atomic<bool>>(false));
+}
+
+bool Movement::isInterrupted() const {
+  return token && *token;
+}
+
+bool Movement::finish() {
+  std::scoped_lock lock{claimMutex};
+  const bool interrupted{isInterrupted()};
+  if(--depth == 0) {
+    owner = nullptr;
+    token.reset();
+  }
+  return interrupted;
+}
+
+bool Movement::claim(const std::shared_ptr<std::atomic<bool>> &iToken) {
+  const pros::task_t caller{pros::c::task_get_current()};
+  std::unique_lock lock{claimMutex};
+  if(owner == caller) {
+    depth++;
+    return true;
+  }
+  while(owner) {
+    if(*iToken) {
+      return false;
+    }
+    lock.unlock();
+    pros::delay(1);
+    lock.lock();
+  }
+  if(*iToken) {
+    return false;
+  }
+  owner = caller;
+  depth = 1;
+  token = iToken;
+  return true;
+}
+
 bool Movement::flipped{false};
 } // namespace atum
\ No newline at end of file
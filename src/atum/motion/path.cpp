@@ -87,7 +87,7 @@ Path::Path(const std::pair<Pose, Pose> &waypoints,
   const degree_t endH{90_deg - end.h};
   endDirection = Pose{params.offRamp * cos(endH), params.offRamp * sin(endH)};
   generate();
-  logger.debug("Path has been generated!");
+  LOG_DEBUG(logger, "Path has been generated!");
 }
 
 Pose Path::getPose(const int i) {
@@ -118,7 +118,7 @@ void Path::generate() {
 
 void Path::parameterize() {
   path[0].v = params.maxV;
-  for(int i{path.size() - 2}; i >= 0; i--) {
+  for(int i{static_cast<int>(path.size()) - 2}; i >= 0; i--) {
     const meters_per_second_squared_t twoD{2.0 * params.maxD};
     const meters_per_second_t decelerated{
         sqrt(path[i + 1].v * path[i + 1].v + twoD * params.spacing)};
@@ -196,7 +196,7 @@ void Path::graphPath() {
   // Can't handle all points on map, so only do those a bit apart from each
   // other.
   const int skip{8_in / params.spacing};
-  for(int i{0}; i < path.size(); i++) {
+  for(int i{0}; i < static_cast<int>(path.size()); i++) {
     if(i % skip == 0) {
       GUI::Map::addPosition(path[i], GUI::SeriesColor::Red);
     }
@@ -46,21 +46,23 @@ PathFollower::PathFollower(Drive *iDrive,
 
 void PathFollower::follow(const std::vector<Command> &commands,
                           const std::string &name) {
-  interrupted = false;
+  if(!start()) {
+    LOG_DEBUG(logger, "Path following was cancelled before it started.");
+    return;
+  }
   if(name.empty()) {
-    logger.debug("Following a path.");
+    LOG_DEBUG(logger, "Following a path.");
   } else {
-    logger.debug("Following a path, \"" + name + ".\"");
+    LOG_DEBUG(logger, "Following a path, \"" + name + ".\"");
   }
-  for(int i{0}; i < commands.size() && !interrupted; i++) {
+  for(std::size_t i{0}; i < commands.size() && !isInterrupted(); i++) {
     follow(commands[i]);
   }
   drive->brake();
-  if(interrupted) {
-    logger.debug("Path following was interrupted!");
-    interrupted = false;
+  if(finish()) {
+    LOG_DEBUG(logger, "Path following was interrupted!");
   } else {
-    logger.debug("Path following complete!");
+    LOG_DEBUG(logger, "Path following complete!");
   }
 }
 
@@ -68,9 +70,10 @@ void PathFollower::follow(Command cmd) {
   reset(cmd);
   Acceptable acceptable{cmd.acceptable.value_or(defaultAcceptable)};
   UnwrappedPose state{drive->getPose()};
+  rate.reset();
   while(getClosest(state) != path->getPose(path->getSize() - 1) &&
         !acceptable.canAccept(distance(drive->getPose(), cmd.target)) &&
-        !interrupted) {
+        !isInterrupted()) {
     state = drive->getPose();
     auto [refV, refH] = getVHReference(state);
     const double aFF = getAccelFeedforward(refV, cmd.reversed);
@@ -87,7 +90,7 @@ void PathFollower::follow(Command cmd) {
     drive->tank(forwardOutput + turnOutput + aFF,
                 forwardOutput - turnOutput + aFF);
     graphPoints(state.v, refV);
-    wait();
+    rate.wait();
   }
 }
 
@@ -18,27 +18,30 @@ void Turn::toward(const Pose &target,
 
 void Turn::toward(degree_t target,
                   const AngularProfile::Parameters &specialParams) {
-  interrupted = false;
+  if(!start()) {
+    LOG_DEBUG(logger, "Turn was cancelled before it started.");
+    return;
+  }
   if(flipped) {
     target *= -1;
   }
-  logger.debug("Turning to " + to_string(target) + ".");
+  LOG_DEBUG(logger, "Turning to " + to_string(target) + ".");
   const degree_t initialHeading{drive->getPose().h};
   const degree_t shortestAngle{constrain180(target - initialHeading)};
   follower->startProfile(
       initialHeading, initialHeading + shortestAngle, specialParams);
-  while(!follower->isDone() && !interrupted) {
+  rate.reset();
+  while(!follower->isDone() && !isInterrupted()) {
     const Pose state{drive->getPose()};
     const double output{follower->getOutput(state.h, state.omega)};
     drive->arcade(0, output);
-    wait();
+    rate.wait();
   }
   drive->brake();
-  if(interrupted) {
-    logger.debug("Turn was interrupted!");
-    interrupted = false;
+  if(finish()) {
+    LOG_DEBUG(logger, "Turn was interrupted!");
   } else {
-    logger.debug("Turn complete!");
+    LOG_DEBUG(logger, "Turn complete!");
   }
 }
 
@@ -0,0 +1,205 @@
+#include "derivativeEstimator.hpp"
+
+namespace atum {
+DerivativeEstimator::Estimate FiniteDifference::update(const double change,
+                                                       const second_t dt) {
+  const double seconds{getValueAs<second_t>(dt)};
+  if(!(seconds > 0.0)) {
+    return estimate;
+  }
+  const double rate{change / seconds};
+  estimate.acceleration = (rate - estimate.rate) / seconds;
+  estimate.rate = rate;
+  return estimate;
+}
+
+void FiniteDifference::reset() {
+  estimate = {};
+}
+
+std::unique_ptr<DerivativeEstimator> FiniteDifference::clone() const {
+  return std::make_unique<FiniteDifference>();
+}
+
+SavitzkyGolay::SavitzkyGolay(const std::size_t iWindow) :
+    window{std::clamp<std::size_t>(iWindow, 3, maxWindow)} {
+  reset();
+}
+
+DerivativeEstimator::Estimate SavitzkyGolay::update(const double change,
+                                                    const second_t dt) {
+  const double seconds{getValueAs<second_t>(dt)};
+  if(!(seconds > 0.0)) {
+    return estimate;
+  }
+  latest = {latest.time + seconds, latest.value + change};
+  samples[next] = latest;
+  next = (next + 1) % window;
+  count = std::min(count + 1, window);
+  // Fits value = c0 + c1 t + c2 t^2, with the time and value relative to the
+  // latest so the sums stay small.
+  std::array<double, 5> timeSums{};
+  std::array<double, 3> valueSums{};
+  for(std::size_t i{0}; i < count; i++) {
+    const double t{samples[i].time - latest.time};
+    const double value{samples[i].value - latest.value};
+    double power{1.0};
+    for(std::size_t k{0}; k < timeSums.size(); k++) {
+      if(k < valueSums.size()) {
+        valueSums[k] += power * value;
+      }
+      timeSums[k] += power;
+      power *= t;
+    }
+  }
+  if(count < 3) {
+    const double spread{timeSums[2] - timeSums[1] * timeSums[1] / count};
+    estimate = {(valueSums[1] - timeSums[1] * valueSums[0] / count) / spread,
+                0.0};
+    return estimate;
+  }
+  auto determinant = [](const std::array<std::array<double, 3>, 3> &m) {
+    return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+           m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+           m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+  };
+  const std::array<std::array<double, 3>, 3> sums{
+      {{timeSums[0], timeSums[1], timeSums[2]},
+       {timeSums[1], timeSums[2], timeSums[3]},
+       {timeSums[2], timeSums[3], timeSums[4]}}};
+  const double whole{determinant(sums)};
+  if(!(std::abs(whole) > 0.0)) {
+    return estimate;
+  }
+  // Cramer's rule, replacing the column of each coefficient with the sums of
+  // the values.
+  auto coefficient = [&](const std::size_t column) {
+    std::array<std::array<double, 3>, 3> replaced{sums};
+    for(std::size_t row{0}; row < 3; row++) {
+      replaced[row][column] = valueSums[row];
+    }
+    return determinant(replaced) / whole;
+  };
+  estimate = {coefficient(1), 2.0 * coefficient(2)};
+  return estimate;
+}
+
+void SavitzkyGolay::reset() {
+  // Starts at rest, as if the value had been read once already.
+  latest = {0.0, 0.0};
+  samples[0] = latest;
+  next = 1;
+  count = 1;
+  estimate = {};
+}
+
+std::unique_ptr<DerivativeEstimator> SavitzkyGolay::clone() const {
+  return std::make_unique<SavitzkyGolay>(window);
+}
+
+AlphaBetaGamma::AlphaBetaGamma(const double iAlpha,
+                               const double iBeta,
+                               const double iGamma) :
+    alpha{iAlpha},
+    beta{iBeta},
+    gamma{iGamma} {}
+
+DerivativeEstimator::Estimate AlphaBetaGamma::update(const double change,
+                                                     const second_t dt) {
+  const double seconds{getValueAs<second_t>(dt)};
+  if(!(seconds > 0.0)) {
+    return estimate;
+  }
+  measured += change;
+  value += estimate.rate * seconds +
+           estimate.acceleration * seconds * seconds / 2.0;
+  estimate.rate += estimate.acceleration * seconds;
+  const double residual{measured - value};
+  value += alpha * residual;
+  estimate.rate += beta * residual / seconds;
+  estimate.acceleration += 2.0 * gamma * residual / (seconds * seconds);
+  // Keeps the values near zero, as only their difference matters.
+  measured -= value;
+  value = 0.0;
+  return estimate;
+}
+
+void AlphaBetaGamma::reset() {
+  measured = 0.0;
+  value = 0.0;
+  estimate = {};
+}
+
+std::unique_ptr<DerivativeEstimator> AlphaBetaGamma::clone() const {
+  return std::make_unique<AlphaBetaGamma>(alpha, beta, gamma);
+}
+
+KalmanDerivative::KalmanDerivative(const double iJerkNoise,
+                                   const double iMeasurementNoise) :
+    jerkNoise{iJerkNoise},
+    measurementNoise{iMeasurementNoise} {}
+
+DerivativeEstimator::Estimate KalmanDerivative::update(const double change,
+                                                       const second_t dt) {
+  const double t{getValueAs<second_t>(dt)};
+  if(!(t > 0.0)) {
+    return {state[1], state[2]};
+  }
+  measured += change;
+  // x = F x, with F integrating the acceleration into the rate and value.
+  state[0] += state[1] * t + state[2] * t * t / 2.0;
+  state[1] += state[2] * t;
+  // P = F P F^T + Q, with Q from jerk as white noise over the update.
+  const std::array<double, 3> f{1.0, t, t * t / 2.0};
+  Covariance &p{covariance};
+  Covariance fp{p};
+  for(std::size_t j{0}; j < 3; j++) {
+    fp[0][j] = f[0] * p[0][j] + f[1] * p[1][j] + f[2] * p[2][j];
+    fp[1][j] = p[1][j] + t * p[2][j];
+  }
+  for(std::size_t i{0}; i < 3; i++) {
+    p[i][0] = fp[i][0] * f[0] + fp[i][1] * f[1] + fp[i][2] * f[2];
+    p[i][1] = fp[i][1] + fp[i][2] * t;
+    p[i][2] = fp[i][2];
+  }
+  const double t2{t * t};
+  const double t3{t2 * t};
+  const Covariance q{{{t3 * t2 / 20.0, t2 * t2 / 8.0, t3 / 6.0},
+                      {t2 * t2 / 8.0, t3 / 3.0, t2 / 2.0},
+                      {t3 / 6.0, t2 / 2.0, t}}};
+  for(std::size_t i{0}; i < 3; i++) {
+    for(std::size_t j{0}; j < 3; j++) {
+      p[i][j] += jerkNoise * q[i][j];
+    }
+  }
+  // H = [1, 0, 0], so the gain is the first column of P over its innovation
+  // variance.
+  const double variance{p[0][0] + measurementNoise * measurementNoise};
+  const std::array<double, 3> gain{
+      p[0][0] / variance, p[1][0] / variance, p[2][0] / variance};
+  const double innovation{measured - state[0]};
+  for(std::size_t i{0}; i < 3; i++) {
+    state[i] += gain[i] * innovation;
+  }
+  const std::array<double, 3> row{p[0]};
+  for(std::size_t i{0}; i < 3; i++) {
+    for(std::size_t j{0}; j < 3; j++) {
+      p[i][j] -= gain[i] * row[j];
+    }
+  }
+  // Keeps the values near zero, as only their difference matters.
+  measured -= state[0];
+  state[0] = 0.0;
+  return {state[1], state[2]};
+}
+
+void KalmanDerivative::reset() {
+  measured = 0.0;
+  state = {};
+  covariance = {};
+}
+
+std::unique_ptr<DerivativeEstimator> KalmanDerivative::clone() const {
+  return std::make_unique<KalmanDerivative>(jerkNoise, measurementNoise);
+}
+} // namespace atum
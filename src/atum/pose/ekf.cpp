@@ -0,0 +1,218 @@
+#include "ekf.hpp"
+
+namespace atum {
+EKF::EKF(std::unique_ptr<Odometer> iForward,
+         std::unique_ptr<Odometer> iSide,
+         std::unique_ptr<IMU> iImu,
+         Drive *iDrive,
+         GPS *iGps,
+         const Parameters &iParams,
+         const Logger::Level loggerLevel) :
+    Odometry(std::move(iForward),
+             std::move(iSide),
+             std::move(iImu),
+             iDrive,
+             loggerLevel),
+    gps{iGps},
+    params{iParams} {
+  setPose(getPose());
+  logger.info("EKF constructed!");
+}
+
+Pose EKF::update() {
+  const Displacement displacement{measure()};
+  const std::optional<PositionReading> reading{readGPS()};
+  // The filter is stepped while the write lock is held, the same order
+  // correctPose takes them in, so a correction can't land before the pose is
+  // published.
+  return stepPose([&](Pose &currentPose) {
+    std::scoped_lock lock{filterMutex};
+    predict(displacement);
+    if(reading) {
+      correctPosition(*reading);
+    }
+    // Rounding can leave the covariance slightly asymmetric over many
+    // updates.
+    for(std::size_t i{0}; i < 3; i++) {
+      for(std::size_t j{i + 1}; j < 3; j++) {
+        covariance[i][j] = covariance[j][i] =
+            (covariance[i][j] + covariance[j][i]) / 2.0;
+      }
+    }
+    currentPose.x = inch_t{state[0]};
+    currentPose.y = inch_t{state[1]};
+    currentPose.h = radian_t{state[2]};
+    estimateMotion(currentPose, displacement);
+    covarianceSnapshot.store(covariance);
+    Telemetry::record(telemetryChannel,
+                      state[0],
+                      state[1],
+                      getValueAs<degree_t>(currentPose.h),
+                      std::sqrt(covariance[0][0]),
+                      std::sqrt(covariance[1][1]),
+                      std::sqrt(covariance[2][2]) * 180.0 / M_PI);
+  });
+}
+
+void EKF::setPose(const Pose &iPose) {
+  {
+    std::scoped_lock lock{filterMutex};
+    state = {getValueAs<inch_t>(iPose.x),
+             getValueAs<inch_t>(iPose.y),
+             getValueAs<radian_t>(iPose.h)};
+    const double positionVariance{
+        std::pow(getValueAs<inch_t>(params.initialPositionNoise), 2)};
+    const double headingVariance{
+        std::pow(getValueAs<radian_t>(params.initialHeadingNoise), 2)};
+    covariance = {{{positionVariance, 0.0, 0.0},
+                   {0.0, positionVariance, 0.0},
+                   {0.0, 0.0, headingVariance}}};
+    covarianceSnapshot.store(covariance);
+  }
+  Tracker::setPose(iPose);
+}
+
+EKF::Covariance EKF::getCovariance() const {
+  return covarianceSnapshot.load();
+}
+
+void EKF::correctState(const Correction &correction) {
+  std::scoped_lock lock{filterMutex};
+  Pose moved{inch_t{state[0]}, inch_t{state[1]}, radian_t{state[2]}};
+  correction.apply(moved);
+  state = {getValueAs<inch_t>(moved.x),
+           getValueAs<inch_t>(moved.y),
+           getValueAs<radian_t>(moved.h)};
+  // P = J P J^T, where J turns the position by the correction's turn.
+  const double c{std::cos(getValueAs<radian_t>(correction.turn))};
+  const double s{std::sin(getValueAs<radian_t>(correction.turn))};
+  const Covariance j{{{c, s, 0.0}, {-s, c, 0.0}, {0.0, 0.0, 1.0}}};
+  Covariance turned{};
+  for(std::size_t row{0}; row < 3; row++) {
+    for(std::size_t column{0}; column < 3; column++) {
+      for(std::size_t k{0}; k < 3; k++) {
+        for(std::size_t l{0}; l < 3; l++) {
+          turned[row][column] +=
+              j[row][k] * covariance[k][l] * j[column][l];
+        }
+      }
+    }
+  }
+  covariance = turned;
+  covarianceSnapshot.store(covariance);
+}
+
+void EKF::predict(const Displacement &displacement) {
+  const double dx{getValueAs<inch_t>(displacement.dx)};
+  const double dy{getValueAs<inch_t>(displacement.dy)};
+  const double dh{getValueAs<radian_t>(displacement.dh)};
+  const double c{std::cos(state[2])};
+  const double s{std::sin(state[2])};
+  state[0] += c * dx + s * dy;
+  state[1] += -s * dx + c * dy;
+  state[2] += dh;
+  // P = F P F^T + G N G^T, where F only differs from the identity in how the
+  // heading moves the position, and G rotates the robot relative noise N.
+  const double f02{-s * dx + c * dy};
+  const double f12{-c * dx - s * dy};
+  Covariance &p{covariance};
+  Covariance fp;
+  for(std::size_t j{0}; j < 3; j++) {
+    fp[0][j] = p[0][j] + f02 * p[2][j];
+    fp[1][j] = p[1][j] + f12 * p[2][j];
+    fp[2][j] = p[2][j];
+  }
+  for(std::size_t i{0}; i < 3; i++) {
+    p[i][0] = fp[i][0] + fp[i][2] * f02;
+    p[i][1] = fp[i][1] + fp[i][2] * f12;
+    p[i][2] = fp[i][2];
+  }
+  const double nx{std::pow(params.translationNoise * dx, 2)};
+  const double ny{std::pow(params.translationNoise * dy, 2)};
+  const double nh{std::pow(params.rotationNoise * dh, 2)};
+  p[0][0] += c * c * nx + s * s * ny;
+  p[0][1] += -c * s * nx + s * c * ny;
+  p[1][0] += -c * s * nx + s * c * ny;
+  p[1][1] += s * s * nx + c * c * ny;
+  p[2][2] += nh;
+}
+
+std::optional<EKF::PositionReading> EKF::readGPS() {
+  if(!gps) {
+    return std::nullopt;
+  }
+  const std::optional<GPS::Reading> reading{gps->getReading()};
+  if(!reading) {
+    return std::nullopt;
+  }
+  const double x{getValueAs<inch_t>(reading->x)};
+  const double y{getValueAs<inch_t>(reading->y)};
+  // The GPS only produces new readings every so often, and using a reading
+  // twice would make the filter too sure of it.
+  if(x == lastGPSX && y == lastGPSY) {
+    return std::nullopt;
+  }
+  lastGPSX = x;
+  lastGPSY = y;
+  PositionReading position{x, y, getValueAs<inch_t>(reading->error), {}};
+  // Readings taken since the last update are compared with the state.
+  if(reading->t < getPose().t) {
+    position.then = getPose(reading->t);
+  }
+  return position;
+}
+
+void EKF::correctPosition(const PositionReading &reading) {
+  Covariance &p{covariance};
+  const double noise{std::pow(reading.error, 2)};
+  // H = [I 0], so S is the position block of P plus the GPS's noise.
+  const double s00{p[0][0] + noise};
+  const double s01{p[0][1]};
+  const double s11{p[1][1] + noise};
+  const double determinant{s00 * s11 - s01 * s01};
+  if(!(determinant > 0.0)) {
+    return;
+  }
+  const double i00{s11 / determinant};
+  const double i01{-s01 / determinant};
+  const double i11{s00 / determinant};
+  double ex{reading.x - state[0]};
+  double ey{reading.y - state[1]};
+  if(reading.then) {
+    // Against where the robot was when the reading was taken, as the motion
+    // tracked since then is already in the state.
+    ex = reading.x - getValueAs<inch_t>(reading.then->x);
+    ey = reading.y - getValueAs<inch_t>(reading.then->y);
+  }
+  const double mahalanobis{ex * (i00 * ex + i01 * ey) +
+                           ey * (i01 * ex + i11 * ey)};
+  if(mahalanobis > params.gpsGate) {
+    gpsRejections.add();
+    return;
+  }
+  // K = P H^T S^-1, the first two columns of P times the inverse of S.
+  std::array<std::array<double, 2>, 3> gain;
+  for(std::size_t i{0}; i < 3; i++) {
+    gain[i][0] = p[i][0] * i00 + p[i][1] * i01;
+    gain[i][1] = p[i][0] * i01 + p[i][1] * i11;
+  }
+  for(std::size_t i{0}; i < 3; i++) {
+    state[i] += gain[i][0] * ex + gain[i][1] * ey;
+  }
+  const std::array<double, 3> row0{p[0]};
+  const std::array<double, 3> row1{p[1]};
+  for(std::size_t i{0}; i < 3; i++) {
+    for(std::size_t j{0}; j < 3; j++) {
+      p[i][j] -= gain[i][0] * row0[j] + gain[i][1] * row1[j];
+    }
+  }
+  gpsUpdates.add();
+}
+
+const Telemetry::Channel EKF::telemetryChannel{Telemetry::addChannel(
+    "ekf", {"x_in", "y_in", "h_deg", "sd_x_in", "sd_y_in", "sd_h_deg"})};
+
+Metrics::Counter EKF::gpsUpdates{"ekf gps updates"};
+
+Metrics::Counter EKF::gpsRejections{"ekf gps rejections"};
+} // namespace atum
@@ -5,10 +5,12 @@ GPS::GPS(const std::int8_t port,
          const Pose &offset,
          const double iHeadingTrust,
          const double iFullPoseTrust,
-         const Logger::Level loggerLevel) :
+         const Logger::Level loggerLevel,
+         const second_t iLatency) :
     headingOffset{offset.h},
     headingTrust{iHeadingTrust},
     fullPoseTrust{iFullPoseTrust},
+    latency{iLatency},
     logger{loggerLevel} {
   gps = std::make_unique<pros::GPS>(port);
   initializeGPS(offset);
@@ -17,10 +19,12 @@ GPS::GPS(const std::int8_t port,
 GPS::GPS(const Pose &offset,
          const double iHeadingTrust,
          const double iFullPoseTrust,
-         const Logger::Level loggerLevel) :
+         const Logger::Level loggerLevel,
+         const second_t iLatency) :
     headingOffset{offset.h},
     headingTrust{iHeadingTrust},
     fullPoseTrust{iFullPoseTrust},
+    latency{iLatency},
     logger{loggerLevel} {
   const auto gpsSensors{pros::GPS::get_all_devices()};
   if(!gpsSensors.size()) {
@@ -50,25 +54,41 @@ Pose GPS::getPose() {
   if(logger.getLevel() >= Logger::Level::Info) {
     GUI::Map::addPosition({x, y}, GUI::SeriesColor::Yellow);
   }
-  logger.debug("GPS pose: " + toString({x, y, h}) + ".");
+  LOG_DEBUG(logger, "GPS pose: " + toString({x, y, h}) + ".");
   return {x, y, h};
 }
 
+std::optional<GPS::Reading> GPS::getReading() {
+  if(!gps->is_installed()) {
+    return std::nullopt;
+  }
+  return Reading{meter_t{gps->get_position_x()},
+                 meter_t{gps->get_position_y()},
+                 meter_t{gps->get_error()},
+                 preciseTime() - latency};
+}
+
 void GPS::resetTracker(Tracker *tracker) {
-  if(!check() || gps->get_error() >= maxError) {
+  if(!check()) {
+    return;
+  }
+  const double error{gps->get_error()};
+  errors.set(error);
+  if(error >= maxError) {
+    rejectedCorrections.add();
     return;
   }
   const Pose currentPose{getPose()};
+  const second_t measuredAt{preciseTime() - latency};
+  const Pose trackerPose{tracker->getPose(measuredAt)};
   Pose newPose{fullPoseTrust * currentPose +
-               (1.0 - fullPoseTrust) * tracker->getPose()};
+               (1.0 - fullPoseTrust) * trackerPose};
   newPose.h = getHeading(currentPose.h);
-  // Don't reset anything but x, y, and h.
-  newPose.v = currentPose.v;
-  newPose.a = currentPose.a;
-  newPose.omega = currentPose.omega;
-  newPose.alpha = currentPose.alpha;
-  newPose.t = currentPose.t;
-  tracker->setPose(newPose);
+  // Only x, y, and h are corrected, as of when the reading was taken.
+  newPose.t = measuredAt;
+  tracker->correctPose(newPose);
+  appliedCorrections.add();
+  corrections.add(getValueAs<inch_t>(distance(newPose, trackerPose)));
 }
 
 bool GPS::check() {
@@ -94,4 +114,12 @@ void GPS::initializeGPS(const UnwrappedPose &offset) {
   gps->set_offset(offset.x, offset.y);
   check();
 }
+
+Metrics::Counter GPS::appliedCorrections{"gps applied corrections"};
+
+Metrics::Counter GPS::rejectedCorrections{"gps rejected corrections"};
+
+Metrics::Histogram GPS::corrections{"gps correction in", {0.5, 1, 2, 4, 8, 16}};
+
+Metrics::Gauge GPS::errors{"gps error m"};
 } // namespace atum
\ No newline at end of file
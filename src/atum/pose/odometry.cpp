@@ -5,13 +5,20 @@ Odometry::Odometry(std::unique_ptr<Odometer> iForward,
                    std::unique_ptr<Odometer> iSide,
                    std::unique_ptr<IMU> iImu,
                    Drive *iDrive,
-                   Logger::Level loggerLevel) :
+                   Logger::Level loggerLevel,
+                   std::unique_ptr<DerivativeEstimator> iForwardEstimator,
+                   std::unique_ptr<DerivativeEstimator> iTurnEstimator) :
     Tracker(loggerLevel),
     Task(this, loggerLevel),
     forward{std::move(iForward)},
     side{std::move(iSide)},
     imu{std::move(iImu)},
-    drive{iDrive} {
+    drive{iDrive},
+    forwardEstimator{iForwardEstimator
+                         ? std::move(iForwardEstimator)
+                         : std::make_unique<FiniteDifference>()},
+    turnEstimator{iTurnEstimator ? std::move(iTurnEstimator)
+                                 : std::make_unique<FiniteDifference>()} {
   if(!forward) {
     logger.error("The forward odometer must be provided.");
   }
@@ -25,6 +32,10 @@ Odometry::Odometry(std::unique_ptr<Odometer> iForward,
 }
 
 Pose Odometry::update() {
+  return integratePose(measure());
+}
+
+Odometry::Displacement Odometry::measure() {
   inch_t dxR{side->traveled()};
   inch_t dyR{forward->traveled()};
   const radian_t dh{imu->getTraveled()};
@@ -48,38 +59,74 @@ Pose Odometry::update() {
     dyR = (dyR + dyRDrive) / 2.0;
   }
   // Accounting for angular velocity.
-  const inch_t dxRAdj{sinDHOverDH * dxR + cosDHMinusOneOverDH * dyR};
-  const inch_t dyRAdj{-cosDHMinusOneOverDH * dxR + sinDHOverDH * dyR};
-  return integratePose(dxRAdj, dyRAdj, dh);
-}
-
-Pose Odometry::integratePose(inch_t dx, inch_t dy, radian_t dh) {
-  if(!std::isfinite(getValueAs<inch_t>(dx)) ||
-     !std::isfinite(getValueAs<inch_t>(dy)) ||
-     !std::isfinite(getValueAs<radian_t>(dh))) {
+  Displacement displacement{
+      sinDHOverDH * dxR + cosDHMinusOneOverDH * dyR,
+      -cosDHMinusOneOverDH * dxR + sinDHOverDH * dyR,
+      dh,
+      timer.timeElapsed()};
+  timer.setTime();
+  periods.add(getValueAs<millisecond_t>(displacement.dt));
+  if(!std::isfinite(getValueAs<inch_t>(displacement.dx)) ||
+     !std::isfinite(getValueAs<inch_t>(displacement.dy)) ||
+     !std::isfinite(getValueAs<radian_t>(displacement.dh))) {
     logger.warn("Invalid values read from odometers.");
-    dx = 0_in;
-    dy = 0_in;
-    dh = 0_rad;
+    invalidReadings.add();
+    displacement.dx = 0_in;
+    displacement.dy = 0_in;
+    displacement.dh = 0_rad;
   }
-  Pose currentPose{getPose()};
-  currentPose.x += cos(currentPose.h) * dx + sin(currentPose.h) * dy;
-  currentPose.y += -sin(currentPose.h) * dx + cos(currentPose.h) * dy;
-  currentPose.h += dh;
-  const second_t dt{timer.timeElapsed()};
-  currentPose.v = dy / dt;
-  currentPose.omega = dh / dt;
-  timer.setTime();
-  setPose(currentPose);
-  return getPose(); // Use getPose() for logging purposes.
+  return displacement;
+}
+
+void Odometry::estimateMotion(Pose &pose, const Displacement &displacement) {
+  const DerivativeEstimator::Estimate forwardEstimate{forwardEstimator->update(
+      getValueAs<meter_t>(displacement.dy), displacement.dt)};
+  const DerivativeEstimator::Estimate turnEstimate{turnEstimator->update(
+      getValueAs<radian_t>(displacement.dh), displacement.dt)};
+  pose.v = meters_per_second_t{forwardEstimate.rate};
+  pose.a = meters_per_second_squared_t{forwardEstimate.acceleration};
+  pose.omega = radians_per_second_t{turnEstimate.rate};
+  pose.alpha = radians_per_second_squared_t{turnEstimate.acceleration};
+}
+
+Pose Odometry::integratePose(const Displacement &displacement) {
+  const Pose currentPose{stepPose([&](Pose &stepped) {
+    const auto [dx, dy, dh, dt]{displacement};
+    stepped.x += cos(stepped.h) * dx + sin(stepped.h) * dy;
+    stepped.y += -sin(stepped.h) * dx + cos(stepped.h) * dy;
+    stepped.h += dh;
+    estimateMotion(stepped, displacement);
+  })};
+  Telemetry::record(telemetryChannel,
+                    getValueAs<inch_t>(currentPose.x),
+                    getValueAs<inch_t>(currentPose.y),
+                    getValueAs<degree_t>(currentPose.h),
+                    getValueAs<inches_per_second_t>(currentPose.v),
+                    getValueAs<inches_per_second_squared_t>(currentPose.a),
+                    getValueAs<degrees_per_second_t>(currentPose.omega),
+                    getValueAs<degrees_per_second_squared_t>(
+                        currentPose.alpha));
+  return currentPose;
 }
 
+const Telemetry::Channel Odometry::telemetryChannel{
+    Telemetry::addChannel("odometry",
+                          {"x_in",
+                           "y_in",
+                           "h_deg",
+                           "v_in_per_s",
+                           "a_in_per_s_sq",
+                           "omega_deg_per_s",
+                           "alpha_deg_per_s_sq"})};
+
+Metrics::Counter Odometry::invalidReadings{"odometry invalid readings"};
+
+Metrics::Histogram Odometry::periods{"odometry period ms",
+                                     {9, 10, 11, 12, 15, 20, 50}};
+
 TASK_DEFINITIONS_FOR(Odometry) {
-  START_TASK("Odometry Loop", TASK_PRIORITY_MAX)
-  while(true) {
-    update();
-    wait(10_ms);
-  }
+  START_PERIODIC_TASK("Odometry Loop", period, TASK_PRIORITY_MAX)
+  update();
   END_TASK
 }
 } // namespace atum
\ No newline at end of file
@@ -0,0 +1,263 @@
+#include "particleFilter.hpp"
+
+namespace atum {
+ParticleFilter::ParticleFilter(std::unique_ptr<Odometer> iForward,
+                               std::unique_ptr<Odometer> iSide,
+                               std::unique_ptr<IMU> iImu,
+                               Drive *iDrive,
+                               std::vector<Beam> iBeams,
+                               const Parameters &iParams,
+                               const Logger::Level loggerLevel) :
+    Odometry(std::move(iForward),
+             std::move(iSide),
+             std::move(iImu),
+             iDrive,
+             loggerLevel),
+    beams{std::move(iBeams)},
+    params{iParams},
+    count{std::max<std::size_t>(iParams.particles, 1)},
+    cosines(count),
+    sines(count),
+    readings(beams.size()) {
+  for(Particles *set : {&particles, &resampled}) {
+    set->x.resize(count);
+    set->y.resize(count);
+    set->h.resize(count);
+    set->weight.resize(count);
+  }
+  for(const Beam &beam : beams) {
+    if(!beam.sensor) {
+      logger.error("A beam was given without a distance sensor.");
+    }
+  }
+  setPose(getPose());
+  logger.info("Particle filter constructed with " + std::to_string(count) +
+              " particles!");
+}
+
+Pose ParticleFilter::update() {
+  const Displacement displacement{measure()};
+  // The filter is stepped while the write lock is held, the same order
+  // correctPose takes them in, so a correction can't land before the pose is
+  // published.
+  return stepPose([&](Pose &currentPose) {
+    std::scoped_lock lock{filterMutex};
+    move(displacement);
+    movedDistance += std::hypot(getValueAs<inch_t>(displacement.dx),
+                                getValueAs<inch_t>(displacement.dy));
+    movedAngle += std::abs(getValueAs<degree_t>(displacement.dh));
+    if(movedDistance >= getValueAs<inch_t>(params.correctionDistance) ||
+       movedAngle >= getValueAs<degree_t>(params.correctionAngle)) {
+      movedDistance = 0.0;
+      movedAngle = 0.0;
+      for(std::size_t i{0}; i < beams.size(); i++) {
+        readings[i] = -1.0f;
+        if(!beams[i].sensor) {
+          continue;
+        }
+        const millimeter_t range{beams[i].sensor->getDistance()};
+        if(range > 0_mm && range < params.maximumRange) {
+          readings[i] = getValueAs<inch_t>(range);
+        }
+      }
+      correct(readings);
+    }
+    currentPose = estimate();
+    estimateMotion(currentPose, displacement);
+  });
+}
+
+void ParticleFilter::setPose(const Pose &iPose) {
+  {
+    std::scoped_lock lock{filterMutex};
+    const float x{static_cast<float>(getValueAs<inch_t>(iPose.x))};
+    const float y{static_cast<float>(getValueAs<inch_t>(iPose.y))};
+    const float h{static_cast<float>(getValueAs<radian_t>(iPose.h))};
+    const float positionNoise{
+        static_cast<float>(getValueAs<inch_t>(params.initialPositionNoise))};
+    const float headingNoise{
+        static_cast<float>(getValueAs<radian_t>(params.initialHeadingNoise))};
+    for(std::size_t i{0}; i < count; i++) {
+      particles.x[i] = x + positionNoise * noise();
+      particles.y[i] = y + positionNoise * noise();
+      particles.h[i] = h + headingNoise * noise();
+      particles.weight[i] = 1.0f / count;
+    }
+    effectiveParticles = count;
+    movedDistance = 0.0;
+    movedAngle = 0.0;
+  }
+  Tracker::setPose(iPose);
+}
+
+void ParticleFilter::correctState(const Correction &correction) {
+  std::scoped_lock lock{filterMutex};
+  for(std::size_t i{0}; i < count; i++) {
+    Pose moved{inch_t{particles.x[i]},
+               inch_t{particles.y[i]},
+               radian_t{particles.h[i]}};
+    correction.apply(moved);
+    particles.x[i] = static_cast<float>(getValueAs<inch_t>(moved.x));
+    particles.y[i] = static_cast<float>(getValueAs<inch_t>(moved.y));
+    particles.h[i] = static_cast<float>(getValueAs<radian_t>(moved.h));
+  }
+}
+
+void ParticleFilter::move(const Displacement &displacement) {
+  const float dx{static_cast<float>(getValueAs<inch_t>(displacement.dx))};
+  const float dy{static_cast<float>(getValueAs<inch_t>(displacement.dy))};
+  const float dh{static_cast<float>(getValueAs<radian_t>(displacement.dh))};
+  const float xNoise{static_cast<float>(params.translationNoise) * dx};
+  const float yNoise{static_cast<float>(params.translationNoise) * dy};
+  const float hNoise{static_cast<float>(params.rotationNoise) * dh};
+  float *const x{particles.x.data()};
+  float *const y{particles.y.data()};
+  float *const h{particles.h.data()};
+  for(std::size_t i{0}; i < count; i++) {
+    const float noisyDX{dx + xNoise * noise()};
+    const float noisyDY{dy + yNoise * noise()};
+    const float c{std::cos(h[i])};
+    const float s{std::sin(h[i])};
+    x[i] += c * noisyDX + s * noisyDY;
+    y[i] += -s * noisyDX + c * noisyDY;
+    h[i] += dh + hNoise * noise();
+  }
+}
+
+void ParticleFilter::correct(const std::vector<float> &ranges) {
+  const float wall{
+      static_cast<float>(getValueAs<inch_t>(params.fieldHalfWidth))};
+  const float outlier{static_cast<float>(params.outlierChance)};
+  const float *const x{particles.x.data()};
+  const float *const y{particles.y.data()};
+  const float *const h{particles.h.data()};
+  float *const weight{particles.weight.data()};
+  float *const c{cosines.data()};
+  float *const s{sines.data()};
+  for(std::size_t i{0}; i < count; i++) {
+    c[i] = std::cos(h[i]);
+    s[i] = std::sin(h[i]);
+  }
+  bool corrected{false};
+  for(std::size_t b{0}; b < beams.size(); b++) {
+    const float range{ranges[b]};
+    if(range < 0.0f) {
+      continue;
+    }
+    corrected = true;
+    const float sigma{std::max(
+        static_cast<float>(params.rangeNoise) * range,
+        static_cast<float>(getValueAs<inch_t>(params.minimumRangeNoise)))};
+    const float scale{-0.5f / (sigma * sigma)};
+    const float bx{static_cast<float>(getValueAs<inch_t>(beams[b].x))};
+    const float by{static_cast<float>(getValueAs<inch_t>(beams[b].y))};
+    const float bh{static_cast<float>(getValueAs<radian_t>(beams[b].h))};
+    const float cosBH{std::cos(bh)};
+    const float sinBH{std::sin(bh)};
+    for(std::size_t i{0}; i < count; i++) {
+      const float originX{x[i] + c[i] * bx + s[i] * by};
+      const float originY{y[i] - s[i] * bx + c[i] * by};
+      const float directionX{s[i] * cosBH + c[i] * sinBH};
+      const float directionY{c[i] * cosBH - s[i] * sinBH};
+      // The beam hits whichever wall it reaches first. Dividing by a zero
+      // direction gives infinity, which the other wall always beats.
+      const float toX{(std::copysign(wall, directionX) - originX) / directionX};
+      const float toY{(std::copysign(wall, directionY) - originY) / directionY};
+      const float error{std::max(std::min(toX, toY), 0.0f) - range};
+      weight[i] *= std::exp(scale * error * error) + outlier;
+    }
+  }
+  if(!corrected) {
+    return;
+  }
+  corrections.add();
+  float sum{0.0f};
+  for(std::size_t i{0}; i < count; i++) {
+    sum += weight[i];
+  }
+  if(!(sum > 0.0f) || !std::isfinite(sum)) {
+    logger.warn("Particle weights collapsed, resetting them.");
+    sum = count;
+    std::fill(particles.weight.begin(), particles.weight.end(), 1.0f);
+  }
+  float sumSquares{0.0f};
+  for(std::size_t i{0}; i < count; i++) {
+    weight[i] /= sum;
+    sumSquares += weight[i] * weight[i];
+  }
+  effectiveParticles = 1.0f / sumSquares;
+  if(effectiveParticles < count / 2.0f) {
+    resample();
+  }
+}
+
+void ParticleFilter::resample() {
+  const float step{1.0f / count};
+  float target{step * (noise() / 3.4641016f + 0.5f)};
+  float cumulative{particles.weight[0]};
+  std::size_t source{0};
+  for(std::size_t i{0}; i < count; i++) {
+    while(target > cumulative && source + 1 < count) {
+      cumulative += particles.weight[++source];
+    }
+    resampled.x[i] = particles.x[source];
+    resampled.y[i] = particles.y[source];
+    resampled.h[i] = particles.h[source];
+    resampled.weight[i] = step;
+    target += step;
+  }
+  std::swap(particles, resampled);
+  effectiveParticles = count;
+  resamples.add();
+}
+
+Pose ParticleFilter::estimate() const {
+  // Headings are averaged relative to one of them, so they aren't wrapped.
+  const double reference{particles.h[0]};
+  double x{0.0};
+  double y{0.0};
+  double h{0.0};
+  for(std::size_t i{0}; i < count; i++) {
+    const double weight{particles.weight[i]};
+    x += weight * particles.x[i];
+    y += weight * particles.y[i];
+    h += weight * constrainPI(particles.h[i] - reference);
+  }
+  h += reference;
+  double xVariance{0.0};
+  double yVariance{0.0};
+  for(std::size_t i{0}; i < count; i++) {
+    xVariance += particles.weight[i] * std::pow(particles.x[i] - x, 2);
+    yVariance += particles.weight[i] * std::pow(particles.y[i] - y, 2);
+  }
+  Telemetry::record(telemetryChannel,
+                    x,
+                    y,
+                    h * 180.0 / M_PI,
+                    std::sqrt(xVariance),
+                    std::sqrt(yVariance),
+                    effectiveParticles);
+  return {inch_t{x}, inch_t{y}, radian_t{h}};
+}
+
+float ParticleFilter::noise() {
+  // Xorshift, which is fast and good enough for spreading particles.
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return ((seed >> 8) / 16777216.0f - 0.5f) * 3.4641016f; // sqrt(12)
+}
+
+const Telemetry::Channel ParticleFilter::telemetryChannel{
+    Telemetry::addChannel("particle filter",
+                          {"x_in",
+                           "y_in",
+                           "h_deg",
+                           "sd_x_in",
+                           "sd_y_in",
+                           "effective_particles"})};
+
+Metrics::Counter ParticleFilter::corrections{"particle filter corrections"};
+
+Metrics::Counter ParticleFilter::resamples{"particle filter resamples"};
+} // namespace atum
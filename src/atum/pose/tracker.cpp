@@ -1,17 +1,157 @@
 #include "tracker.hpp"
 
 namespace atum {
-Tracker::Tracker(const Logger::Level loggerLevel) : logger{loggerLevel} {}
+Tracker::Tracker(const Logger::Level loggerLevel) : logger{loggerLevel} {
+  if(logger.getLevel() >= Logger::Level::Info) {
+    addObserver(
+        [](const Pose &pose) {
+          GUI::Map::addPosition(pose, GUI::SeriesColor::Green);
+        },
+        mapInterval);
+  }
+  if(logger.getLevel() >= Logger::Level::Debug) {
+    addObserver(
+        [this](const Pose &pose) {
+          LOG_DEBUG(logger, "Tracker pose: " + toString(pose) + ".");
+        },
+        logInterval);
+  }
+}
 
 void Tracker::setPose(const Pose &iPose) {
-  pose = iPose;
+  Pose stamped{iPose};
+  stamped.t = preciseTime();
+  std::scoped_lock lock{writeMutex};
+  store(stamped);
+}
+
+void Tracker::store(const Pose &stamped) {
+  const Pose previous{pose.load()};
+  pose.store(stamped);
+  if(historyCount < historySize) {
+    historyAt(historyCount++) = stamped;
+  } else {
+    history[historyStart] = stamped;
+    historyStart = (historyStart + 1) % historySize;
+  }
+  if(stamped.x != previous.x || stamped.y != previous.y ||
+     stamped.h != previous.h) {
+    changeSignal.raise();
+  }
+  for(Subscription &subscription : subscriptions) {
+    if(subscription.interval > 0_s) {
+      if(stamped.t < subscription.due) {
+        continue;
+      }
+      // Steps by the interval so jitter in when poses are set evens out, but
+      // doesn't try to catch up after a gap.
+      subscription.due += subscription.interval;
+      if(subscription.due <= stamped.t) {
+        subscription.due = stamped.t + subscription.interval;
+      }
+      subscription.observer(stamped);
+    } else if(++subscription.skipped >= subscription.decimation) {
+      subscription.skipped = 0;
+      subscription.observer(stamped);
+    }
+  }
 }
 
 Pose Tracker::getPose() {
-  if(logger.getLevel() >= Logger::Level::Info) {
-    GUI::Map::addPosition(pose, GUI::SeriesColor::Green);
+  return pose.load();
+}
+
+Pose Tracker::getPose(const second_t time) {
+  std::scoped_lock lock{writeMutex};
+  return interpolate(time);
+}
+
+void Tracker::correctPose(const Pose &measured) {
+  std::scoped_lock lock{writeMutex};
+  const Pose then{interpolate(measured.t)};
+  const Correction correction{
+      then, measured, constrain180(measured.h - then.h)};
+  for(std::size_t i{0}; i < historyCount; i++) {
+    if(historyAt(i).t >= measured.t) {
+      correction.apply(historyAt(i));
+    }
+  }
+  Pose corrected{pose.load()};
+  correction.apply(corrected);
+  correctState(correction);
+  corrected.t = preciseTime();
+  store(corrected);
+}
+
+void Tracker::Correction::apply(Pose &moved) const {
+  const double c{std::cos(getValueAs<radian_t>(turn))};
+  const double s{std::sin(getValueAs<radian_t>(turn))};
+  const meter_t dx{moved.x - then.x};
+  const meter_t dy{moved.y - then.y};
+  moved.x = measured.x + c * dx + s * dy;
+  moved.y = measured.y - s * dx + c * dy;
+  moved.h += turn;
+}
+
+void Tracker::correctState(const Correction &) {}
+
+void Tracker::addObserver(const Observer &observer,
+                          const std::size_t decimation) {
+  std::scoped_lock lock{writeMutex};
+  // The first pose set after subscribing is observed.
+  subscriptions.push_back(
+      {observer, std::max<std::size_t>(decimation, 1), decimation, 0_s, 0_s});
+}
+
+void Tracker::addObserver(const Observer &observer, const second_t interval) {
+  std::scoped_lock lock{writeMutex};
+  // The first pose set after subscribing is observed.
+  subscriptions.push_back({observer, 1, 0, interval, 0_s});
+}
+
+const Signal &Tracker::getChangeSignal() const {
+  return changeSignal;
+}
+
+Pose &Tracker::historyAt(const std::size_t index) {
+  return history[(historyStart + index) % historySize];
+}
+
+Pose Tracker::interpolate(const second_t time) {
+  if(!historyCount) {
+    return pose.load();
+  }
+  // Finds the first pose kept at or after the time.
+  std::size_t low{0};
+  std::size_t high{historyCount};
+  while(low < high) {
+    const std::size_t middle{(low + high) / 2};
+    if(historyAt(middle).t < time) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  if(low == 0) {
+    return historyAt(0);
+  }
+  if(low == historyCount) {
+    return historyAt(historyCount - 1);
   }
-  logger.debug("Tracker pose: " + toString(pose) + ".");
-  return pose;
+  const Pose &before{historyAt(low - 1)};
+  const Pose &after{historyAt(low)};
+  const double fraction{getValueAs<second_t>(time - before.t) /
+                        getValueAs<second_t>(after.t - before.t)};
+  auto between = [fraction](const auto start, const auto end) {
+    return start + fraction * (end - start);
+  };
+  return {between(before.x, after.x),
+          between(before.y, after.y),
+          before.h + fraction * constrain180(after.h - before.h),
+          between(before.v, after.v),
+          between(before.a, after.a),
+          between(before.omega, after.omega),
+          between(before.alpha, after.alpha),
+          time};
 }
 } // namespace atum
\ No newline at end of file
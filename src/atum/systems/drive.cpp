@@ -21,6 +21,18 @@ Drive::Drive(std::unique_ptr<Motor> iLeft,
 
 void Drive::setTracker(std::unique_ptr<Tracker> iTracker) {
   tracker = std::move(iTracker);
+  if(tracker) {
+    // The tracker is owned by the drive, so never outlives it.
+    tracker->addObserver([this, previous = tracker->getPose()](
+                             const Pose &pose) mutable {
+      if(pose.x != previous.x || pose.y != previous.y ||
+         pose.h != previous.h) {
+        previous = pose;
+        changeSignal.raise();
+      }
+    });
+  }
+  changeSignal.raise();
 }
 
 void Drive::tank(const double leftVoltage, const double rightVoltage) {
@@ -94,6 +106,7 @@ meters_per_second_t Drive::getMaxVelocity() const {
 }
 
 Condition Drive::checkIsNear(const Pose pose, const meter_t threshold) {
-  return [=]() { return distance(getPose(), pose) <= threshold; };
+  return when(changeSignal,
+              [=, this]() { return distance(getPose(), pose) <= threshold; });
 }
 } // namespace atum
\ No newline at end of file
@@ -6,7 +6,7 @@ Remote::Remote(const Type type, const Logger::Level loggerLevel) :
     remote{static_cast<pros::controller_id_e_t>(type)},
     logger{loggerLevel} {
   remote.clear();
-  logger.debug("Remote is constructed!");
+  LOG_DEBUG(logger, "Remote is constructed!");
   startBackgroundTasks();
 }
 
@@ -65,9 +65,17 @@ bool Remote::getHold(const Button button) {
 }
 
 void Remote::print(const std::uint8_t line, const std::string &message) {
-  if(rowQueues[line].size() < printQueueSize) {
-    rowQueues[line].push(message + linePadding);
+  // Dropped if the line is already backed up.
+  if(rowQueues[line].size() >= printQueueSize) {
+    return;
   }
+  Line output;
+  output.fill(' ');
+  std::copy_n(message.begin(),
+              std::min(message.size(), lineLength),
+              output.begin());
+  output.back() = '\0';
+  rowQueues[line].push(output);
 }
 
 void Remote::rumble(const std::string &pattern) {
@@ -75,19 +83,14 @@ void Remote::rumble(const std::string &pattern) {
 }
 
 TASK_DEFINITIONS_FOR(Remote) {
-  START_TASK("Print Handler")
-  while(true) {
-    for(std::size_t line{0}; line < 3; line++) {
-      if(rowQueues[line].size()) {
-        const auto output = rowQueues[line].front();
-        rowQueues[line].pop();
-        remote.set_text(line, 0, output);
-      }
-      wait(minimumPrintDelay);
-    }
+  // Prints to one line per period, cycling through them.
+  START_PERIODIC_TASK("Print Handler", minimumPrintDelay)
+  Line output;
+  if(rowQueues[printLine].pop(output)) {
+    remote.set_text(printLine, 0, output.data());
   }
+  printLine = (printLine + 1) % rowQueues.size();
   END_TASK
 }
 
-const std::string Remote::linePadding{"                   "};
 } // namespace atum
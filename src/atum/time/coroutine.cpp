@@ -0,0 +1,263 @@
+#include "coroutine.hpp"
+#include "rate.hpp"
+#include <algorithm>
+#include <atomic>
+
+namespace atum {
+/**
+ * @brief Checks on every waiter of the routines it runs each standard delay,
+ * resuming the routines whose waiters are ready.
+ *
+ */
+class Coroutine::Runner {
+  public:
+  void add(Waiter *waiter) {
+    waiters.push_back(waiter);
+  }
+
+  void remove(Waiter *waiter) {
+    std::replace(waiters.begin(), waiters.end(), waiter, (Waiter *)nullptr);
+  }
+
+  // Starts a routine without anything waiting on it finishing.
+  void start(Coroutine &routine) {
+    routine.handle.promise().runner = this;
+    routine.handle.resume();
+  }
+
+  void run(Coroutine &routine) {
+    start(routine);
+    Rate rate;
+    while(!routine.isDone()) {
+      rate.wait();
+      poll();
+    }
+  }
+
+  private:
+  void poll() {
+    // Indexed, as resuming may add waiters or remove those of cancelled
+    // routines.
+    for(std::size_t i{0}; i < waiters.size(); i++) {
+      Waiter *waiter{waiters[i]};
+      if(waiter && waiter->ready()) {
+        waiters[i] = nullptr;
+        waiter->runner = nullptr;
+        waiter->handle.resume();
+      }
+    }
+    std::erase(waiters, nullptr);
+  }
+
+  std::vector<Waiter *> waiters;
+};
+
+Coroutine Coroutine::promise_type::get_return_object() {
+  return Coroutine{std::coroutine_handle<promise_type>::from_promise(*this)};
+}
+
+std::suspend_always Coroutine::promise_type::initial_suspend() noexcept {
+  return {};
+}
+
+bool Coroutine::promise_type::FinalAwaiter::await_ready() noexcept {
+  return false;
+}
+
+std::coroutine_handle<> Coroutine::promise_type::FinalAwaiter::await_suspend(
+    std::coroutine_handle<promise_type> handle) noexcept {
+  // Whoever awaited the routine picks up where it left off.
+  if(const std::coroutine_handle<> continuation{
+         handle.promise().continuation}) {
+    return continuation;
+  }
+  return std::noop_coroutine();
+}
+
+void Coroutine::promise_type::FinalAwaiter::await_resume() noexcept {}
+
+Coroutine::promise_type::FinalAwaiter
+    Coroutine::promise_type::final_suspend() noexcept {
+  return {};
+}
+
+void Coroutine::promise_type::return_void() {}
+
+void Coroutine::promise_type::unhandled_exception() {
+  std::terminate();
+}
+
+Coroutine::Waiter::~Waiter() {
+  if(runner) {
+    runner->remove(this);
+  }
+}
+
+bool Coroutine::Waiter::await_ready() {
+  return false;
+}
+
+bool Coroutine::Waiter::await_suspend(std::coroutine_handle<promise_type> iHandle) {
+  runner = iHandle.promise().runner;
+  handle = iHandle;
+  start();
+  if(ready()) {
+    runner = nullptr;
+    return false;
+  }
+  runner->add(this);
+  return true;
+}
+
+void Coroutine::Waiter::await_resume() {}
+
+void Coroutine::Waiter::start() {}
+
+Coroutine::Coroutine(std::coroutine_handle<promise_type> iHandle) :
+    handle{iHandle} {}
+
+Coroutine::Coroutine(Coroutine &&other) noexcept :
+    handle{std::exchange(other.handle, nullptr)} {}
+
+Coroutine &Coroutine::operator=(Coroutine &&other) noexcept {
+  if(this != &other) {
+    if(handle) {
+      handle.destroy();
+    }
+    handle = std::exchange(other.handle, nullptr);
+  }
+  return *this;
+}
+
+Coroutine::~Coroutine() {
+  if(handle) {
+    handle.destroy();
+  }
+}
+
+void Coroutine::run() {
+  Runner runner;
+  runner.run(*this);
+}
+
+bool Coroutine::isDone() const {
+  return !handle || handle.done();
+}
+
+namespace {
+class Sleep : public Coroutine::Waiter {
+  public:
+  explicit Sleep(const second_t iDuration) : duration{iDuration} {}
+
+  protected:
+  void start() override {
+    end = time() + duration;
+  }
+
+  bool ready() override {
+    return time() >= end;
+  }
+
+  private:
+  second_t duration;
+  second_t end;
+};
+
+class Until : public Coroutine::Waiter {
+  public:
+  explicit Until(const Condition &iCondition) : condition{iCondition} {}
+
+  protected:
+  bool ready() override {
+    return condition();
+  }
+
+  private:
+  const Condition &condition;
+};
+
+class Blocking : public Coroutine::Waiter {
+  public:
+  Blocking(const std::function<void()> &iAction,
+           const std::function<void()> &iCancel) :
+      action{iAction},
+      cancel{iCancel} {}
+
+  ~Blocking() {
+    if(done && !*done && cancel) {
+      cancel();
+    }
+  }
+
+  protected:
+  void start() override {
+    // Shared with the task, which may outlive the routine if it is cancelled.
+    done = std::make_shared<std::atomic<bool>>(false);
+    pros::Task{[done = done, action = action]() {
+      action();
+      *done = true;
+    }};
+  }
+
+  bool ready() override {
+    return *done;
+  }
+
+  private:
+  const std::function<void()> &action;
+  const std::function<void()> &cancel;
+  std::shared_ptr<std::atomic<bool>> done;
+};
+
+class Group : public Coroutine::Waiter {
+  public:
+  Group(std::vector<Coroutine> &iRoutines, const bool iAll) :
+      routines{iRoutines},
+      all{iAll} {}
+
+  protected:
+  void start() override {
+    for(Coroutine &routine : routines) {
+      runner->start(routine);
+    }
+  }
+
+  bool ready() override {
+    auto isDone = [](const Coroutine &routine) { return routine.isDone(); };
+    return all ? std::all_of(routines.begin(), routines.end(), isDone)
+               : std::any_of(routines.begin(), routines.end(), isDone);
+  }
+
+  private:
+  std::vector<Coroutine> &routines;
+  const bool all;
+};
+} // namespace
+
+Coroutine sleep(const second_t duration) {
+  co_await Sleep{duration};
+}
+
+Coroutine until(const Condition condition) {
+  co_await Until{condition};
+}
+
+Coroutine async(const std::function<void()> action,
+              const std::function<void()> cancel) {
+  co_await Blocking{action, cancel};
+}
+
+Coroutine whenAll(std::vector<Coroutine> routines) {
+  co_await Group{routines, true};
+}
+
+Coroutine whenAny(std::vector<Coroutine> routines) {
+  co_await Group{routines, false};
+  // Cancels the rest now rather than whenever this routine is destroyed.
+  routines.clear();
+}
+
+Coroutine withTimeout(Coroutine routine, const second_t timeout) {
+  co_await whenAny(std::move(routine), sleep(timeout));
+}
+} // namespace atum
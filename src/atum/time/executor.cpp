@@ -0,0 +1,208 @@
+#include "executor.hpp"
+
+namespace atum {
+namespace {
+struct Entry {
+  Executor::Handle handle;
+  std::string name;
+  std::uint32_t period;
+  std::uint32_t priority;
+  std::function<void()> callback;
+  std::uint32_t release;
+  TaskStats *stats;
+  std::uint32_t overruns{0};
+  bool active{true};
+  // Set while the callback runs, so removing it can wait for it to finish.
+  bool running{false};
+};
+
+struct Worker {
+  std::uint32_t priority;
+  std::unique_ptr<pros::Task> task;
+  pros::task_t current{nullptr};
+  // Reused every cycle so the worker does not allocate.
+  std::vector<Entry *> due;
+};
+
+struct ExecutorState {
+  pros::Mutex mutex;
+  // Removed entries are erased by their worker, between runs.
+  std::vector<std::unique_ptr<Entry>> entries;
+  Executor::Handle nextHandle{0};
+  std::vector<std::unique_ptr<Worker>> workers;
+  Logger logger;
+};
+
+// Constructed on first use, as tasks may be registered during static
+// initialization.
+ExecutorState &state() {
+  static ExecutorState *executorState{new ExecutorState};
+  return *executorState;
+}
+
+// Wraparound-safe comparison of millisecond timestamps.
+bool reached(const std::uint32_t now, const std::uint32_t time) {
+  return static_cast<std::int32_t>(now - time) >= 0;
+}
+
+Entry *find(ExecutorState &s, const Executor::Handle handle) {
+  for(auto &entry : s.entries) {
+    if(entry->handle == handle) {
+      return entry.get();
+    }
+  }
+  return nullptr;
+}
+} // namespace
+
+Executor::Handle Executor::add(const std::string &name,
+                               const second_t period,
+                               const std::uint32_t priority,
+                               const std::function<void()> &callback,
+                               TaskStats *stats) {
+  ExecutorState &s{state()};
+  std::scoped_lock lock{s.mutex};
+  const std::uint32_t periodMs{
+      std::max(getValueAs<millisecond_t, std::uint32_t>(period), 1u)};
+  const Handle handle{s.nextHandle++};
+  s.entries.push_back(std::make_unique<Entry>(Entry{
+      handle, name, periodMs, priority, callback, pros::millis(), stats}));
+  const bool hasWorker{std::any_of(
+      s.workers.begin(), s.workers.end(), [priority](const auto &worker) {
+        return worker->priority == priority;
+      })};
+  if(!hasWorker) {
+    auto worker{std::make_unique<Worker>()};
+    worker->priority = priority;
+    worker->due.reserve(8);
+    const std::string workerName{"Executor " + std::to_string(priority)};
+    worker->task = std::make_unique<pros::Task>([priority]() { work(priority); },
+                                                priority,
+                                                TASK_STACK_DEPTH_DEFAULT,
+                                                workerName.c_str());
+    s.workers.push_back(std::move(worker));
+    LOG_DEBUG(s.logger, "Executor worker with priority " +
+                        std::to_string(priority) + " has started.");
+  }
+  LOG_DEBUG(s.logger, "\"" + name + "\" will run every " +
+                      std::to_string(periodMs) + " ms.");
+  return handle;
+}
+
+void Executor::remove(const Handle handle) {
+  ExecutorState &s{state()};
+  std::unique_lock lock{s.mutex};
+  Entry *entry{find(s, handle)};
+  if(!entry) {
+    return;
+  }
+  entry->active = false;
+  // A callback removing itself can't wait for itself to finish.
+  const pros::task_t caller{pros::c::task_get_current()};
+  for(auto &worker : s.workers) {
+    if(worker->priority == entry->priority && worker->current == caller) {
+      return;
+    }
+  }
+  // Whatever the callback uses may be destroyed once this returns. The worker
+  // may erase the entry while unlocked, so it is found again on every pass.
+  while(entry && entry->running) {
+    lock.unlock();
+    pros::delay(1);
+    lock.lock();
+    entry = find(s, handle);
+  }
+}
+
+std::uint32_t Executor::getOverruns(const Handle handle) {
+  ExecutorState &s{state()};
+  std::scoped_lock lock{s.mutex};
+  const Entry *entry{find(s, handle)};
+  return entry ? entry->overruns : 0;
+}
+
+void Executor::work(const std::uint32_t priority) {
+  ExecutorState &s{state()};
+  Worker *worker{nullptr};
+  {
+    std::scoped_lock lock{s.mutex};
+    for(auto &candidate : s.workers) {
+      if(candidate->priority == priority) {
+        worker = candidate.get();
+      }
+    }
+    worker->current = pros::c::task_get_current();
+  }
+  while(true) {
+    std::uint32_t now{pros::millis()};
+    {
+      std::scoped_lock lock{s.mutex};
+      worker->due.clear();
+      // Nothing else holds on to removed entries, as they aren't running and
+      // were only ever due on this worker.
+      std::erase_if(s.entries, [priority](const auto &entry) {
+        return !entry->active && entry->priority == priority;
+      });
+      for(auto &entry : s.entries) {
+        if(entry->active && entry->priority == priority &&
+           reached(now, entry->release)) {
+          worker->due.push_back(entry.get());
+        }
+      }
+    }
+    // Rate-monotonic: the shorter the period, the sooner it runs.
+    std::sort(worker->due.begin(),
+              worker->due.end(),
+              [](const Entry *a, const Entry *b) {
+                return a->period < b->period;
+              });
+    for(Entry *entry : worker->due) {
+      {
+        // Removed after being found due, so it must not run.
+        std::scoped_lock lock{s.mutex};
+        if(!entry->active) {
+          continue;
+        }
+        entry->running = true;
+      }
+      if(entry->stats) {
+        entry->stats->begin(entry->release * 1000ull, entry->period * 1000ull);
+      }
+      entry->callback();
+      if(entry->stats) {
+        entry->stats->end();
+      }
+      {
+        std::scoped_lock lock{s.mutex};
+        entry->running = false;
+      }
+      now = pros::millis();
+      entry->release += entry->period;
+      if(!reached(entry->release, now)) {
+        entry->overruns++;
+        s.logger.warn("\"" + entry->name + "\" overran its " +
+                      std::to_string(entry->period) + " ms period.");
+        // Skip the releases that were missed instead of bursting to catch up.
+        while(!reached(entry->release, now)) {
+          entry->release += entry->period;
+        }
+      }
+    }
+    now = pros::millis();
+    std::uint32_t next{now + getValueAs<millisecond_t, std::uint32_t>(
+                                 standardDelay)};
+    {
+      std::scoped_lock lock{s.mutex};
+      for(auto &entry : s.entries) {
+        if(entry->active && entry->priority == priority &&
+           reached(next, entry->release)) {
+          next = entry->release;
+        }
+      }
+    }
+    if(!reached(now, next)) {
+      pros::Task::delay_until(&now, next - now);
+    }
+  }
+}
+} // namespace atum
@@ -0,0 +1,54 @@
+#include "rate.hpp"
+
+namespace atum {
+Rate::Rate(const second_t iPeriod) :
+    period{std::max(getValueAs<millisecond_t, std::uint32_t>(iPeriod), 1u)} {
+  reset();
+}
+
+void Rate::reset() {
+  start = pros::millis();
+  next = start;
+  wakes = 0;
+  slip = 0;
+}
+
+void Rate::wait() {
+  TaskStats *stats{TaskStats::current()};
+  if(stats) {
+    stats->end();
+  }
+  std::uint32_t wake{next};
+  pros::Task::delay_until(&wake, period);
+  next += period;
+  const std::uint32_t now{pros::millis()};
+  const std::uint32_t late{now - next};
+  if(static_cast<std::int32_t>(late) > 0) {
+    slip += late;
+    // Skip any wakes that were missed entirely instead of bursting.
+    if(late >= period) {
+      next += late / period * period;
+    }
+  }
+  wakes++;
+  if(stats) {
+    stats->begin(next * 1000ull, period * 1000ull);
+  }
+}
+
+second_t Rate::getPeriod() const {
+  return millisecond_t{static_cast<double>(period)};
+}
+
+hertz_t Rate::getFrequency() const {
+  const std::uint32_t elapsed{pros::millis() - start};
+  if(!elapsed) {
+    return 0_Hz;
+  }
+  return hertz_t{wakes * 1000.0 / elapsed};
+}
+
+second_t Rate::getSlip() const {
+  return millisecond_t{static_cast<double>(slip)};
+}
+} // namespace atum
@@ -11,58 +11,164 @@ Scheduler::Scheduler(const Logger::Level loggerLevel) :
     Task{this, loggerLevel},
     logger{loggerLevel} {
   startBackgroundTasks();
-  logger.debug("Scheduler constructed!");
+  LOG_DEBUG(logger, "Scheduler constructed!");
 }
 
 Scheduler::~Scheduler() {
-  while(scheduled.size()) {
-    scheduled.pop();
+  stopBackgroundTasks();
+  LOG_DEBUG(logger, "Scheduler was interrupted (out of scope).");
+}
+
+Scheduler::Handle Scheduler::schedule(const Scheduler::Item &toSchedule) {
+  const Handle handle{nextHandle++};
+  // Armed properly once the scheduler's task takes it in.
+  if(!requested.push({toSchedule,
+                      handle,
+                      pros::competition::get_status(),
+                      0_s,
+                      0_s})) {
+    logger.warn("Too many items scheduled at once, so \"" + toSchedule.name +
+                "\" was dropped.");
+    return invalidHandle;
+  }
+  if(const pros::task_t task{loopTask}) {
+    pros::c::task_notify(task);
+  }
+  LOG_DEBUG(logger, "The item \"" + toSchedule.name + "\" has been scheduled.");
+  return handle;
+}
+
+void Scheduler::cancel(const Handle handle) {
+  if(!cancelled.push(handle)) {
+    logger.warn("Too many items cancelled at once, so one was not.");
+    return;
+  }
+  if(const pros::task_t task{loopTask}) {
+    pros::c::task_notify(task);
+  }
+}
+
+void Scheduler::takeRequests() {
+  Pending request;
+  while(requested.pop(request)) {
+    arm(request, time());
+    pending.push_back(std::move(request));
+  }
+  Handle handle;
+  while(cancelled.pop(handle)) {
+    for(Pending &item : pending) {
+      if(item.handle == handle && !item.done) {
+        item.done = true;
+        LOG_DEBUG(logger, "The scheduled item \"" + item.item.name +
+                          "\" was cancelled.");
+      }
+    }
   }
-  logger.debug("Scheduler was interrupted (out of scope).");
 }
 
-void Scheduler::schedule(const Scheduler::Item &toSchedule) {
-  if(scheduled.size()) {
-    logger.warn("Scheduling another item before previous is completed.");
+void Scheduler::arm(Pending &item, const second_t start) {
+  item.armed = start;
+  item.deadline = start + item.item.timeout;
+  // Forces the condition to be checked once armed.
+  item.generations.clear();
+  auto push = [this, &item](const second_t wakeTime) {
+    wakeTimes.push_back({wakeTime, item.handle});
+    std::push_heap(wakeTimes.begin(), wakeTimes.end(), std::greater<>{});
+  };
+  if(item.armed > time()) {
+    push(item.armed);
+  }
+  if(item.item.timeout < forever) {
+    push(item.deadline);
+  }
+}
+
+bool Scheduler::inputsChanged(Pending &item) {
+  const std::vector<const Signal *> &inputs{item.item.inputs};
+  if(inputs.empty()) {
+    return true;
+  }
+  bool changed{item.generations.size() != inputs.size()};
+  item.generations.resize(inputs.size());
+  for(std::size_t i{0}; i < inputs.size(); i++) {
+    const std::uint32_t generation{inputs[i]->getGeneration()};
+    changed = changed || item.generations[i] != generation;
+    item.generations[i] = generation;
+  }
+  return changed;
+}
+
+void Scheduler::perform(Pending &item, const bool timedOut) {
+  if(timedOut) {
+    if(item.item.todoTimeout.has_value()) {
+      item.item.todoTimeout.value()();
+    } else {
+      item.item.todo();
+    }
+    LOG_DEBUG(logger, "The scheduled item \"" + item.item.name +
+                      "\" has timed out.");
+  } else {
+    item.item.todo();
+    LOG_DEBUG(logger,
+              "The scheduled item \"" + item.item.name + "\" is finished.");
+  }
+  if(item.item.repeatAfter.has_value()) {
+    arm(item, time() + item.item.repeatAfter.value());
+  } else {
+    item.done = true;
   }
-  scheduled.push(toSchedule);
-  logger.debug("The item \"" + toSchedule.name + "\" has been scheduled.");
 }
 
 TASK_DEFINITIONS_FOR(Scheduler) {
   START_TASK("Scheduler Loop")
+  loopTask = pros::c::task_get_current();
+  std::vector<Handle> expired;
   while(true) {
-    wait(schedulerLoopDelay);
-    if(scheduled.size()) {
-      Item item{scheduled.front()};
-      const uint8_t initialStatus{pros::competition::get_status()};
-      Timer timer{item.timeout};
-      while(pros::competition::get_status() == initialStatus &&
-            !timer.goneOff() && !item.condition()) {
-        wait(schedulerLoopDelay);
+    takeRequests();
+    const std::uint8_t status{pros::competition::get_status()};
+    for(Pending &item : pending) {
+      if(!item.done && item.status != status) {
+        item.done = true;
+        LOG_DEBUG(logger, "The scheduled item \"" + item.item.name +
+                          "\" was interrupted (status change).");
       }
-      if(pros::competition::get_status() != initialStatus) {
-        while(scheduled.size()) {
-          scheduled.pop();
+    }
+    const second_t now{time()};
+    // Collected first so items rearmed while performing wait for the next
+    // pass.
+    expired.clear();
+    while(wakeTimes.size() && wakeTimes.front().first <= now) {
+      expired.push_back(wakeTimes.front().second);
+      std::pop_heap(wakeTimes.begin(), wakeTimes.end(), std::greater<>{});
+      wakeTimes.pop_back();
+    }
+    for(const Handle handle : expired) {
+      for(Pending &item : pending) {
+        if(item.handle == handle && !item.done && item.deadline <= now) {
+          perform(item, true);
         }
-        logger.debug("Scheduled items were interrupted (status change).");
-        continue;
       }
-      if(item.timeout && timer.goneOff()) {
-        if(item.todoTimeout.has_value()) {
-          item.todoTimeout.value();
-        } else {
-          item.todo();
-        }
-        scheduled.pop();
-        logger.debug("The scheduled item \"" + item.name + "\" has timed out.");
+    }
+    bool polling{false};
+    for(Pending &item : pending) {
+      if(item.done || item.armed > now) {
         continue;
       }
-      item.todo();
-      scheduled.pop();
-      logger.debug("The scheduled item \"" + item.name + "\" is finished.");
+      if(inputsChanged(item) && item.item.condition()) {
+        perform(item, false);
+      }
+      polling = polling || (!item.done && item.armed <= now);
+    }
+    std::erase_if(pending, [](const Pending &item) { return item.done; });
+    if(pending.empty()) {
+      wakeTimes.clear();
+    }
+    second_t timeout{polling ? schedulerLoopDelay : second_t{forever}};
+    if(wakeTimes.size()) {
+      timeout = std::min(timeout, wakeTimes.front().first - time());
     }
+    waitForNotification(std::max<second_t>(timeout, 1_ms));
   }
   END_TASK
 }
-} // namespace atum
\ No newline at end of file
+} // namespace atum
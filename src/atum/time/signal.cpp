@@ -0,0 +1,11 @@
+#include "signal.hpp"
+
+namespace atum {
+void Signal::raise() {
+  generation++;
+}
+
+std::uint32_t Signal::getGeneration() const {
+  return generation;
+}
+} // namespace atum
@@ -3,17 +3,45 @@
 namespace atum {
 void Task::startBackgroundTasks() {
   // If the tasks have already started, don't try to start them again.
-  if(tasks.size()) {
+  if(tasks.size() || periodicTasks.size()) {
     return;
   }
-  for(TaskParams params : taskParams) {
-    auto task = std::make_unique<pros::Task>(params.taskFn,
+  if(taskStats.empty()) {
+    for(const TaskParams &params : taskParams) {
+      taskStats.push_back(std::make_unique<TaskStats>(params.name));
+    }
+  }
+  for(std::size_t i{0}; i < taskParams.size(); i++) {
+    const TaskParams &params{taskParams[i]};
+    TaskStats *stats{taskStats[i].get()};
+    if(params.period) {
+      periodicTasks.push_back(Executor::add(params.name,
+                                            params.period.value(),
+                                            params.priority,
+                                            params.taskFn,
+                                            stats));
+      LOG_DEBUG(taskLogger,
+                "Periodic task \"" + params.name + "\" with priority " +
+                std::to_string(params.priority) + " has started.");
+      continue;
+    }
+    stats->setStackDepth(params.stackDepth);
+    // Iterations after the first are delimited by calls to wait.
+    auto taskFn = [stats, taskFn = params.taskFn]() {
+      stats->attach();
+      stats->begin(pros::micros(), 0);
+      taskFn();
+      stats->end();
+    };
+    auto task = std::make_unique<pros::Task>(taskFn,
                                              params.priority,
-                                             TASK_STACK_DEPTH_DEFAULT,
+                                             params.stackDepth,
                                              params.name.c_str());
     tasks.push_back(std::move(task));
-    taskLogger.debug("Task \"" + params.name + "\" with priority " +
-                     std::to_string(params.priority) + " has started.");
+    LOG_DEBUG(taskLogger,
+              "Task \"" + params.name + "\" with priority " +
+              std::to_string(params.priority) + " and stack depth " +
+              std::to_string(params.stackDepth) + " has started.");
   }
 }
 
@@ -22,7 +50,11 @@ void Task::stopBackgroundTasks() {
     task->remove();
   }
   tasks.clear();
-  taskLogger.debug("Tasks associated with \"" + handlerName +
-                   "\" have been stopped.");
+  for(const Executor::Handle handle : periodicTasks) {
+    Executor::remove(handle);
+  }
+  periodicTasks.clear();
+  LOG_DEBUG(taskLogger, "Tasks associated with \"" + handlerName +
+                        "\" have been stopped.");
 }
-} // namespace atum
\ No newline at end of file
+} // namespace atum
@@ -0,0 +1,228 @@
+#include "taskStats.hpp"
+
+namespace atum {
+TaskStats::TaskStats(const std::string &iName) : name{iName} {
+  const std::size_t index{registered.fetch_add(1)};
+  if(index < maxTasks) {
+    registry[index] = this;
+  }
+}
+
+TaskStats::~TaskStats() {
+  for(auto &stats : registry) {
+    TaskStats *self{this};
+    stats.compare_exchange_strong(self, nullptr);
+  }
+}
+
+void TaskStats::attach() {
+  task = pros::c::task_get_current();
+}
+
+void TaskStats::begin(const std::uint64_t expectedUs,
+                      const std::uint64_t periodUs) {
+  startUs = pros::micros();
+  deadlineUs = periodUs ? expectedUs + periodUs : 0;
+  running = true;
+  const std::uint32_t jitterUs{
+      startUs > expectedUs ? static_cast<std::uint32_t>(startUs - expectedUs)
+                           : 0};
+  totalJitterUs += jitterUs;
+  maxJitterUs = std::max(maxJitterUs, jitterUs);
+}
+
+void TaskStats::end() {
+  if(!running) {
+    return;
+  }
+  running = false;
+  const std::uint64_t endUs{pros::micros()};
+  const std::uint32_t executionUs{static_cast<std::uint32_t>(endUs - startUs)};
+  totalExecutionUs += executionUs;
+  minExecutionUs = std::min(minExecutionUs, executionUs);
+  maxExecutionUs = std::max(maxExecutionUs, executionUs);
+  histogram[std::min<std::size_t>(executionUs / binUs, bins - 1)]++;
+  if(deadlineUs && endUs > deadlineUs) {
+    missedDeadlines++;
+  }
+  // Checking the stack walks it, so it isn't done every iteration. Starts from
+  // the second, as the first may not have gone as deep as the loop does.
+  if(iterations++ % stackSamplePeriod == 1) {
+    stackHighWaterMark = std::min(
+        stackHighWaterMark, pros::c::task_get_stack_high_water_mark(nullptr));
+    if(stackHighWaterMark < stackWarning && !stackWarned) {
+      stackWarned = true;
+      Logger{}.warn("Task \"" + name + "\" has only " +
+                    std::to_string(getStackHighWaterMark()) +
+                    " bytes of stack left!");
+    }
+  }
+}
+
+const std::string &TaskStats::getName() const {
+  return name;
+}
+
+std::uint32_t TaskStats::getIterations() const {
+  return iterations;
+}
+
+std::uint32_t TaskStats::getMissedDeadlines() const {
+  return missedDeadlines;
+}
+
+second_t TaskStats::getMinExecution() const {
+  if(!iterations) {
+    return 0_s;
+  }
+  return microsecond_t{static_cast<double>(minExecutionUs)};
+}
+
+second_t TaskStats::getMeanExecution() const {
+  if(!iterations) {
+    return 0_s;
+  }
+  return microsecond_t{static_cast<double>(totalExecutionUs) / iterations};
+}
+
+second_t TaskStats::getMaxExecution() const {
+  return microsecond_t{static_cast<double>(maxExecutionUs)};
+}
+
+second_t TaskStats::getP99Execution() const {
+  if(!iterations) {
+    return 0_s;
+  }
+  const std::uint64_t threshold{(iterations * 99ull + 99) / 100};
+  std::uint64_t count{0};
+  for(std::size_t bin{0}; bin < bins - 1; bin++) {
+    count += histogram[bin];
+    if(count >= threshold) {
+      return std::min<second_t>(
+          microsecond_t{static_cast<double>((bin + 1) * binUs)},
+          getMaxExecution());
+    }
+  }
+  return getMaxExecution();
+}
+
+second_t TaskStats::getMeanJitter() const {
+  if(!iterations) {
+    return 0_s;
+  }
+  return microsecond_t{static_cast<double>(totalJitterUs) / iterations};
+}
+
+second_t TaskStats::getMaxJitter() const {
+  return microsecond_t{static_cast<double>(maxJitterUs)};
+}
+
+std::size_t TaskStats::getStackHighWaterMark() const {
+  if(stackHighWaterMark == std::numeric_limits<std::uint32_t>::max()) {
+    return 0;
+  }
+  return stackHighWaterMark * sizeof(std::uint32_t);
+}
+
+void TaskStats::setStackDepth(const std::uint32_t iStackDepth) {
+  stackDepth = iStackDepth;
+}
+
+std::size_t TaskStats::getPeakStackUse() const {
+  if(!stackDepth ||
+     stackHighWaterMark == std::numeric_limits<std::uint32_t>::max()) {
+    return 0;
+  }
+  return (stackDepth - std::min(stackDepth, stackHighWaterMark)) *
+         sizeof(std::uint32_t);
+}
+
+std::uint32_t TaskStats::getSuggestedStackDepth() const {
+#ifdef ATUM_SIMULATED
+  return 0;
+#else
+  const std::size_t peakWords{getPeakStackUse() / sizeof(std::uint32_t)};
+  if(!peakWords) {
+    return 0;
+  }
+  const std::uint32_t suggested{
+      static_cast<std::uint32_t>(peakWords + peakWords / 2 + stackMargin)};
+  // Rounded up to a whole 256 words.
+  return std::max<std::uint32_t>((suggested + 255) / 256 * 256,
+                                 TASK_STACK_DEPTH_MIN);
+#endif
+}
+
+std::string TaskStats::toString() const {
+  auto ms = [](const second_t time) { return getValueAs<millisecond_t>(time); };
+  std::stringstream summary{};
+  summary << std::fixed << std::setprecision(2) << '"' << name
+          << "\": " << iterations << " iterations, execution min/mean/p99/max "
+          << ms(getMinExecution()) << '/' << ms(getMeanExecution()) << '/'
+          << ms(getP99Execution()) << '/' << ms(getMaxExecution())
+          << " ms, jitter mean/max " << ms(getMeanJitter()) << '/'
+          << ms(getMaxJitter()) << " ms, " << missedDeadlines
+          << " missed deadlines, " << getStackHighWaterMark()
+          << " bytes of stack free";
+  return summary.str();
+}
+
+const TaskStats *TaskStats::find(const std::string &name) {
+  const std::size_t count{std::min(registered.load(), maxTasks)};
+  for(std::size_t i{0}; i < count; i++) {
+    const TaskStats *stats{registry[i]};
+    if(stats && stats->name == name) {
+      return stats;
+    }
+  }
+  return nullptr;
+}
+
+TaskStats *TaskStats::current() {
+  const pros::task_t currentTask{pros::c::task_get_current()};
+  const std::size_t count{std::min(registered.load(), maxTasks)};
+  for(std::size_t i{0}; i < count; i++) {
+    TaskStats *stats{registry[i]};
+    if(stats && stats->task == currentTask) {
+      return stats;
+    }
+  }
+  return nullptr;
+}
+
+void TaskStats::logAll() {
+  Logger logger;
+  const std::size_t count{std::min(registered.load(), maxTasks)};
+  for(std::size_t i{0}; i < count; i++) {
+    if(const TaskStats *stats{registry[i]}) {
+      logger.info(stats->toString());
+    }
+  }
+}
+
+void TaskStats::logStackDepths() {
+  Logger logger;
+  const std::size_t count{std::min(registered.load(), maxTasks)};
+  for(std::size_t i{0}; i < count; i++) {
+    const TaskStats *stats{registry[i]};
+    if(!stats || !stats->getPeakStackUse()) {
+      continue;
+    }
+    const std::string use{
+        std::to_string(stats->getPeakStackUse()) + " of " +
+        std::to_string(stats->stackDepth * sizeof(std::uint32_t)) + " bytes"};
+    if(const std::uint32_t suggested{stats->getSuggestedStackDepth()}) {
+      logger.info("\"" + stats->name + "\": peak stack use " + use +
+                  ", suggested stack depth " + std::to_string(suggested) +
+                  " words.");
+    } else {
+      logger.info("\"" + stats->name + "\": peak stack use at least " + use +
+                  ", as only where it blocked was seen.");
+    }
+  }
+}
+
+std::array<std::atomic<TaskStats *>, TaskStats::maxTasks> TaskStats::registry{};
+
+std::atomic<std::size_t> TaskStats::registered{0};
+} // namespace atum
@@ -1,17 +1,49 @@
 #include "time.hpp"
+#include "taskStats.hpp"
 
 namespace atum {
 second_t time() {
-  return millisecond_t{pros::millis()};
+  return millisecond_t{static_cast<double>(pros::millis())};
+}
+
+second_t preciseTime() {
+  return microsecond_t{static_cast<double>(pros::micros())};
 }
 
 void wait(const second_t delay) {
   if(delay == 0_s) {
     return;
   }
+  // The time spent waiting separates the iterations of a task's loop.
+  TaskStats *stats{TaskStats::current()};
+  if(stats) {
+    stats->end();
+  }
   std::uint32_t now{pros::millis()};
   const std::uint32_t then{getValueAs<millisecond_t, std::uint32_t>(delay)};
   pros::Task::delay_until(&now, then);
+  if(stats) {
+    stats->begin(now * 1000ull, then * 1000ull);
+  }
+}
+
+bool waitForNotification(const second_t timeout) {
+  TaskStats *stats{TaskStats::current()};
+  if(stats) {
+    stats->end();
+  }
+  // Rounded rather than truncated so a timeout just under a millisecond
+  // doesn't return immediately.
+  const std::uint32_t timeoutMs{
+      timeout < forever
+          ? static_cast<std::uint32_t>(
+                std::lround(getValueAs<millisecond_t>(timeout)))
+          : TIMEOUT_MAX};
+  const bool notified{pros::Task::notify_take(true, timeoutMs) > 0};
+  if(stats) {
+    stats->begin(pros::micros(), 0);
+  }
+  return notified;
 }
 
 void waitUntil(const Condition &condition,
@@ -2,9 +2,9 @@
 
 namespace atum {
 Timer::Timer(const second_t iAlarmTime) :
-    startTime{time()},
+    startTime{preciseTime()},
     alarmTime{iAlarmTime},
-    previousTime{time()} {}
+    previousTime{preciseTime()} {}
 
 void Timer::setAlarm(const second_t iAlarmTime) {
   alarmTime = iAlarmTime;
@@ -12,8 +12,8 @@ void Timer::setAlarm(const second_t iAlarmTime) {
 }
 
 void Timer::setTime(const second_t newTime) {
-  startTime = time() - newTime;
-  previousTime = time();
+  startTime = preciseTime() - newTime;
+  previousTime = preciseTime();
 }
 
 void Timer::start() {
@@ -34,17 +34,17 @@ bool Timer::goneOff() const {
 }
 
 second_t Timer::timeElapsed() const {
-  return time() - startTime;
+  return preciseTime() - startTime;
 }
 
 second_t Timer::getDT() {
-  const second_t currentTime{time()};
+  const second_t currentTime{preciseTime()};
   const second_t dt{currentTime - previousTime};
   previousTime = currentTime;
   return dt;
 }
 
 Condition Timer::checkGoneOff() const {
-  return [=]() { return goneOff(); };
+  return [=, this]() { return goneOff(); };
 }
 } // namespace atum
\ No newline at end of file
@@ -1,15 +1,8 @@
 #include "logger.hpp"
+#include <cstdio>
 
 namespace atum {
-Logger::Logger(Level iLevel) : level{iLevel} {
-  // Denote new logging session.
-  std::scoped_lock lock{logMutex};
-  if(!beganLogging) {
-    beganLogging = true;
-    std::fstream file{logFilename, std::fstream::app};
-    file << '\n' << "~~~~~~~~~~~~ BEGIN LOG ~~~~~~~~~~~~\n";
-  }
-}
+Logger::Logger(Level iLevel) : level{iLevel} {}
 
 void Logger::debug(const std::string &msg) {
   if(level == Logger::Level::Off) {
@@ -19,25 +12,28 @@ void Logger::debug(const std::string &msg) {
 }
 
 void Logger::info(const std::string &msg) {
-  if(alreadyLogged(msg)) {
+  std::uint32_t repeats;
+  if(alreadyLogged(msg, Level::Info, repeats)) {
     return;
   }
-  log("INFO", msg, Level::Info);
+  log("INFO", msg, Level::Info, repeats);
 }
 
 void Logger::warn(const std::string &msg) {
-  if(alreadyLogged(msg)) {
+  std::uint32_t repeats;
+  if(alreadyLogged(msg, Level::Warn, repeats)) {
     return;
   }
-  log("WARN", msg, Level::Warn);
+  log("WARN", msg, Level::Warn, repeats);
 }
 
 void Logger::error(const std::string &msg) {
-  if(alreadyLogged(msg)) {
+  std::uint32_t repeats;
+  if(alreadyLogged(msg, Level::Error, repeats)) {
     return;
   }
   GUI::Manager::error();
-  log("ERROR", msg, Level::Error);
+  log("ERROR", msg, Level::Error, repeats);
 }
 
 Logger::Level Logger::getLevel() const {
@@ -46,35 +42,150 @@ Logger::Level Logger::getLevel() const {
 
 void Logger::log(const std::string &prefix,
                  const std::string &msg,
-                 Level msgLevel) {
-  std::scoped_lock lock{logMutex};
+                 Level msgLevel,
+                 const std::uint32_t repeats) {
   if(level < msgLevel) {
     return;
   }
-  std::stringstream fmtMsg{};
-  fmtMsg << std::setw(5) << prefix << std::setw(0) << ": " + msg << '\n';
-  std::cout << fmtMsg.str();
-  if(msgLevel <= Level::Info) {
-    std::fstream file{logFilename, std::fstream::app};
-    file << fmtMsg.str();
-    GUI::Log::write(fmtMsg.str());
+  startFlushing();
+  Entry entry{};
+  entry.level = msgLevel;
+  const int length{
+      repeats ? std::snprintf(entry.text.data(),
+                              maxMessageLength,
+                              "%5s: %s (suppressed %lu repeats)\n",
+                              prefix.c_str(),
+                              msg.c_str(),
+                              static_cast<unsigned long>(repeats))
+              : std::snprintf(entry.text.data(),
+                              maxMessageLength,
+                              "%5s: %s\n",
+                              prefix.c_str(),
+                              msg.c_str())};
+  if(length >= static_cast<int>(maxMessageLength)) {
+    constexpr char cutOff[]{"...\n"};
+    std::copy(std::begin(cutOff),
+              std::end(cutOff),
+              entry.text.end() - sizeof(cutOff));
+  }
+  if(!buffer.push(entry)) {
+    dropped++;
   }
 }
 
-bool Logger::alreadyLogged(const std::string &msg) {
-  if(level == Logger::Level::Off) {
-    return true;
+void Logger::flush() {
+  std::scoped_lock lock{flushMutex};
+  if(!file.is_open()) {
+    // Denote new logging session.
+    file.open(logFilename, std::ofstream::app);
+    file << '\n' << "~~~~~~~~~~~~ BEGIN LOG ~~~~~~~~~~~~\n";
+  }
+  Entry entry;
+  while(buffer.pop(entry)) {
+    std::cout << entry.text.data();
+    if(entry.level <= Level::Info) {
+      file << entry.text.data();
+      GUI::Log::write(entry.text.data());
+    }
+  }
+  const std::uint32_t totalDropped{dropped};
+  if(totalDropped != reportedDropped) {
+    const std::string report{
+        " WARN: " + std::to_string(totalDropped - reportedDropped) +
+        " log messages were dropped (buffer full).\n"};
+    reportedDropped = totalDropped;
+    std::cout << report;
+    file << report;
+  }
+  file.flush();
+}
+
+std::uint32_t Logger::getDropped() {
+  return dropped;
+}
+
+void Logger::startFlushing() {
+  if(flushing.exchange(true)) {
+    return;
   }
-  if(std::find(logs.begin(), logs.end(), msg) != logs.end()) {
+  pros::Task{[]() {
+               while(true) {
+                 flush();
+                 pros::delay(flushPeriod);
+               }
+             },
+             TASK_PRIORITY_MIN + 1,
+             TASK_STACK_DEPTH_DEFAULT,
+             "Logger Flush"};
+}
+
+bool Logger::alreadyLogged(const std::string &msg,
+                           const Level msgLevel,
+                           std::uint32_t &repeats) {
+  if(level < msgLevel) {
     return true;
   }
-  logs.push_back(msg);
+  const std::size_t hash{std::hash<std::string>{}(msg)};
+  const std::uint32_t now{pros::millis()};
+  checks++;
+  Seen *oldest{&seen.front()};
+  for(Seen &message : seen) {
+    if(message.used && message.hash == hash) {
+      message.seenAt = checks;
+      if(now - message.loggedAt < repeatWindow) {
+        message.repeats++;
+        return true;
+      }
+      repeats = message.repeats;
+      message.repeats = 0;
+      message.loggedAt = now;
+      return false;
+    }
+    if(!message.used || (oldest->used && message.seenAt < oldest->seenAt)) {
+      oldest = &message;
+    }
+  }
+  if(oldest->used && oldest->repeats) {
+    // Otherwise the repeats since it was last logged would never be reported.
+    log(prefixOf(oldest->level),
+        oldest->excerpt.data(),
+        oldest->level,
+        oldest->repeats);
+  }
+  *oldest = {hash, now, checks, 0, msgLevel, true};
+  const std::size_t length{std::min(msg.size(), seenExcerptLength - 1)};
+  std::copy_n(msg.begin(), length, oldest->excerpt.begin());
+  oldest->excerpt[length] = '\0';
+  if(length < msg.size()) {
+    constexpr char cutOff[]{"..."};
+    std::copy(std::begin(cutOff),
+              std::end(cutOff),
+              oldest->excerpt.end() - sizeof(cutOff));
+  }
+  repeats = 0;
   return false;
 }
 
+const char *Logger::prefixOf(const Level msgLevel) {
+  switch(msgLevel) {
+    case Level::Debug: return "DEBUG";
+    case Level::Info: return "INFO";
+    case Level::Warn: return "WARN";
+    default: return "ERROR";
+  }
+}
+
 const std::string Logger::logFilename{"log.txt"};
 
-bool Logger::beganLogging{false};
+RingBuffer<Logger::Entry, Logger::bufferedMessages> Logger::buffer{};
+
+std::atomic<bool> Logger::flushing{false};
+
+std::atomic<std::uint32_t> Logger::dropped{0};
+
+std::uint32_t Logger::reportedDropped{0};
+
+std::ofstream Logger::file{};
 
-pros::Mutex Logger::logMutex{};
+pros::Mutex Logger::flushMutex{};
 } // namespace atum
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include "metrics.hpp"
+#include "../time/executor.hpp"
+#include <cstdio>
+
+namespace atum {
+const std::string &Metrics::Metric::getName() const {
+  return name;
+}
+
+Metrics::Metric::Metric(const std::string &iName,
+                        const std::vector<std::string> &fields) :
+    name{iName},
+    channel{Telemetry::addChannel(iName, fields)} {
+  getMetrics().push_back(this);
+}
+
+Metrics::Counter::Counter(const std::string &iName) : Metric(iName, {"count"}) {}
+
+void Metrics::Counter::add(const std::uint32_t amount) {
+  count.fetch_add(amount, std::memory_order_relaxed);
+}
+
+std::uint32_t Metrics::Counter::get() const {
+  return count.load(std::memory_order_relaxed);
+}
+
+Metrics::Reading Metrics::Counter::read() const {
+  return {name, Kind::Counter, static_cast<double>(get()), {}, {}};
+}
+
+void Metrics::Counter::record() const {
+  Telemetry::record(channel, get());
+}
+
+Metrics::Gauge::Gauge(const std::string &iName) : Metric(iName, {"value"}) {}
+
+void Metrics::Gauge::set(const double iValue) {
+  value.store(static_cast<float>(iValue), std::memory_order_relaxed);
+}
+
+double Metrics::Gauge::get() const {
+  return value.load(std::memory_order_relaxed);
+}
+
+Metrics::Reading Metrics::Gauge::read() const {
+  return {name, Kind::Gauge, get(), {}, {}};
+}
+
+void Metrics::Gauge::record() const {
+  Telemetry::record(channel, get());
+}
+
+Metrics::Histogram::Histogram(const std::string &iName,
+                              const std::initializer_list<double> iBounds) :
+    Metric(iName, bucketFields(iBounds)) {
+  for(const double bound : iBounds) {
+    if(boundCount == maxBounds) {
+      break;
+    }
+    bounds[boundCount++] = bound;
+  }
+}
+
+void Metrics::Histogram::add(const double sample) {
+  std::size_t bucket{0};
+  while(bucket < boundCount && sample > bounds[bucket]) {
+    bucket++;
+  }
+  buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+Metrics::Reading Metrics::Histogram::read() const {
+  Reading reading{name,
+                  Kind::Histogram,
+                  0.0,
+                  {bounds.begin(), bounds.begin() + boundCount},
+                  {}};
+  for(std::size_t i{0}; i <= boundCount; i++) {
+    reading.buckets.push_back(buckets[i].load(std::memory_order_relaxed));
+    reading.value += reading.buckets.back();
+  }
+  return reading;
+}
+
+void Metrics::Histogram::record() const {
+  std::array<float, Telemetry::maxFields> counts{};
+  for(std::size_t i{0}; i <= boundCount; i++) {
+    counts[i] = buckets[i].load(std::memory_order_relaxed);
+  }
+  Telemetry::record(channel,
+                    counts[0],
+                    counts[1],
+                    counts[2],
+                    counts[3],
+                    counts[4],
+                    counts[5],
+                    counts[6],
+                    counts[7]);
+}
+
+std::vector<std::string>
+    Metrics::Histogram::bucketFields(const std::initializer_list<double> bounds) {
+  std::vector<std::string> fields;
+  char field[32];
+  for(const double bound : bounds) {
+    if(fields.size() == maxBounds) {
+      break;
+    }
+    std::snprintf(field, sizeof(field), "le_%g", bound);
+    fields.push_back(field);
+  }
+  if(bounds.size()) {
+    std::snprintf(field,
+                  sizeof(field),
+                  "gt_%g",
+                  *(bounds.begin() + fields.size() - 1));
+    fields.push_back(field);
+  } else {
+    fields.push_back("count");
+  }
+  return fields;
+}
+
+std::vector<Metrics::Reading> Metrics::snapshot() {
+  std::vector<Reading> readings;
+  readings.reserve(getMetrics().size());
+  for(const Metric *metric : getMetrics()) {
+    readings.push_back(metric->read());
+  }
+  return readings;
+}
+
+std::string Metrics::toString(const Reading &reading) {
+  char line[64];
+  if(reading.kind == Kind::Counter) {
+    std::snprintf(line, sizeof(line), ": %.0f", reading.value);
+    return reading.name + line;
+  }
+  if(reading.kind == Kind::Gauge) {
+    std::snprintf(line, sizeof(line), ": %.3g", reading.value);
+    return reading.name + line;
+  }
+  std::string string{reading.name};
+  std::snprintf(line, sizeof(line), ": %.0f |", reading.value);
+  string += line;
+  for(std::size_t i{0}; i < reading.buckets.size(); i++) {
+    if(i < reading.bounds.size()) {
+      std::snprintf(
+          line, sizeof(line), " <=%g:%u", reading.bounds[i], reading.buckets[i]);
+    } else {
+      std::snprintf(line, sizeof(line), " >:%u", reading.buckets[i]);
+    }
+    string += line;
+  }
+  return string;
+}
+
+void Metrics::record() {
+  if(!Telemetry::isRecording()) {
+    return;
+  }
+  for(const Metric *metric : getMetrics()) {
+    metric->record();
+  }
+}
+
+void Metrics::startRecording(const second_t period) {
+  Executor::add("Metrics Recording", period, TASK_PRIORITY_MIN + 1, record);
+}
+
+std::vector<Metrics::Metric *> &Metrics::getMetrics() {
+  static std::vector<Metric *> metrics;
+  return metrics;
+}
+} // namespace atum
@@ -0,0 +1,179 @@
+#include "telemetry.hpp"
+#include "logger.hpp"
+#include <cstring>
+#include <limits>
+#include <mutex>
+
+namespace atum {
+Telemetry::Channel Telemetry::addChannel(const std::string &name,
+                                         const std::vector<std::string> &fields,
+                                         const Precision precision) {
+  std::vector<Description> &descriptions{getDescriptions()};
+  const std::size_t limit{precision == Precision::Double ? maxPreciseFields :
+                                                           maxFields};
+  if(descriptions.size() >= syncChannel || fields.size() > limit) {
+    refused++;
+    return syncChannel; // Never recorded.
+  }
+  descriptions.push_back({name, fields, precision});
+  return descriptions.size() - 1;
+}
+
+bool Telemetry::isRecording() {
+  return recording.load(std::memory_order_relaxed);
+}
+
+void Telemetry::start(const std::string &filename) {
+  stop();
+  std::scoped_lock lock{fileMutex};
+  if(refused) {
+    Logger{}.warn(std::to_string(refused) +
+                  " telemetry channels had too many fields or were past the "
+                  "limit, and will not be recorded.");
+  }
+  file.open(filename, std::ofstream::binary | std::ofstream::trunc);
+  if(!file.is_open()) {
+    Logger{}.error("Could not open " + filename + " for telemetry.");
+    return;
+  }
+  const std::vector<Description> &descriptions{getDescriptions()};
+  file.write(magic, sizeof(magic));
+  file.put(static_cast<char>(descriptions.size()));
+  for(std::size_t i{0}; i < descriptions.size(); i++) {
+    file.put(static_cast<char>(i));
+    file.put(static_cast<char>(descriptions[i].fields.size()));
+    file.put(static_cast<char>(descriptions[i].precision));
+    file.write(descriptions[i].name.c_str(), descriptions[i].name.size() + 1);
+    for(const std::string &field : descriptions[i].fields) {
+      file.write(field.c_str(), field.size() + 1);
+    }
+  }
+  blockUsed = 0;
+  previousTime = pros::micros();
+  writeSync(previousTime);
+  describedChannels = static_cast<Channel>(descriptions.size());
+  startFlushing();
+  recording = true;
+}
+
+void Telemetry::stop() {
+  recording = false;
+  std::scoped_lock lock{fileMutex};
+  if(!file.is_open()) {
+    return;
+  }
+  drain();
+  writeBlock();
+  file.close();
+}
+
+void Telemetry::flush() {
+  std::scoped_lock lock{fileMutex};
+  if(!file.is_open()) {
+    return;
+  }
+  drain();
+  writeBlock();
+  file.flush();
+}
+
+std::uint32_t Telemetry::getDropped() {
+  return dropped;
+}
+
+void Telemetry::push(const Channel channel,
+                     const std::array<float, maxFields> &values) {
+  if(channel >= describedChannels.load(std::memory_order_relaxed)) {
+    return;
+  }
+  if(!buffer.push({channel, pros::micros(), values})) {
+    dropped++;
+  }
+}
+
+void Telemetry::drain() {
+  Entry entry;
+  while(buffer.pop(entry)) {
+    // Records from different tasks can arrive slightly out of order, so the
+    // difference is signed.
+    const std::int64_t delta{static_cast<std::int64_t>(entry.time) -
+                             static_cast<std::int64_t>(previousTime)};
+    if(delta > std::numeric_limits<std::int16_t>::max() ||
+       delta < std::numeric_limits<std::int16_t>::min()) {
+      writeSync(entry.time);
+      previousTime = entry.time;
+    }
+    write({entry.channel,
+           0,
+           static_cast<std::int16_t>(entry.time - previousTime),
+           entry.values});
+    previousTime = entry.time;
+  }
+}
+
+void Telemetry::writeSync(const std::uint64_t time) {
+  Record sync{syncChannel, 0, 0, {}};
+  std::memcpy(sync.values.data(), &time, sizeof(time));
+  write(sync);
+}
+
+void Telemetry::write(const Record &record) {
+  if(blockUsed + sizeof(Record) > blockSize) {
+    writeBlock();
+  }
+  std::memcpy(block.data() + blockUsed, &record, sizeof(Record));
+  blockUsed += sizeof(Record);
+}
+
+void Telemetry::writeBlock() {
+  file.write(block.data(), blockUsed);
+  blockUsed = 0;
+}
+
+std::vector<Telemetry::Description> &Telemetry::getDescriptions() {
+  static std::vector<Description> descriptions;
+  return descriptions;
+}
+
+void Telemetry::startFlushing() {
+  if(flushing.exchange(true)) {
+    return;
+  }
+  pros::Task{[]() {
+               while(true) {
+                 {
+                   std::scoped_lock lock{fileMutex};
+                   if(file.is_open()) {
+                     drain();
+                   }
+                 }
+                 pros::delay(flushPeriod);
+               }
+             },
+             TASK_PRIORITY_MIN + 1,
+             TASK_STACK_DEPTH_DEFAULT,
+             "Telemetry Flush"};
+}
+
+RingBuffer<Telemetry::Entry, Telemetry::bufferedRecords> Telemetry::buffer{};
+
+std::atomic<bool> Telemetry::recording{false};
+
+std::atomic<bool> Telemetry::flushing{false};
+
+std::atomic<Telemetry::Channel> Telemetry::describedChannels{0};
+
+std::atomic<std::uint32_t> Telemetry::dropped{0};
+
+std::uint32_t Telemetry::refused{0};
+
+std::ofstream Telemetry::file{};
+
+std::array<char, Telemetry::blockSize> Telemetry::block{};
+
+std::size_t Telemetry::blockUsed{0};
+
+std::uint64_t Telemetry::previousTime{0};
+
+pros::Mutex Telemetry::fileMutex{};
+} // namespace atum
@@ -94,6 +94,7 @@ void Intake::intaking() {
 }
 
 void Intake::unjamming() {
+  jams.add();
   mtr->moveVoltage(-12);
   wait(params.timeUntilUnjammed);
   if(returnState == IntakeState::Loading) {
@@ -118,12 +119,14 @@ void Intake::sorting() {
   }
   // Short delay after seems to provide minor advantage.
   wait();
+  sorts.add();
   mtr->moveVoltage(-12);
   wait(params.sortThrowTime);
   forceIntake(returnState);
 }
 
 void Intake::finishLoading() {
+  loads.add();
   mtr->moveVoltage(params.intakingVoltage);
   wait(params.pressLoadTime);
   mtr->moveVoltage(-12);
@@ -158,9 +161,20 @@ bool Intake::shouldSort() const {
          colorSensor->getColor() == sortOutColor;
 }
 
+const Telemetry::Channel Intake::telemetryChannel{
+    Telemetry::addChannel("intake", {"state"})};
+
+Metrics::Counter Intake::jams{"intake jams"};
+
+Metrics::Counter Intake::sorts{"intake sorts"};
+
+Metrics::Counter Intake::loads{"intake loads"};
+
 TASK_DEFINITIONS_FOR(Intake) {
   START_TASK("Intake State Machine")
+  Rate rate{50_ms};
   while(true) {
+    Telemetry::record(telemetryChannel, static_cast<int>(state));
     switch(state) {
       case IntakeState::Idle: mtr->brake(); break;
       case IntakeState::Loading:
@@ -176,7 +190,7 @@ TASK_DEFINITIONS_FOR(Intake) {
       case IntakeState::Jammed: unjamming(); break;
       case IntakeState::Sorting: sorting(); break;
     }
-    wait(50_ms);
+    rate.wait();
   }
   END_TASK
 }
@@ -136,6 +136,7 @@ void Ladybrown::changeState(const LadybrownState newState,
 void Ladybrown::moveTo(const LadybrownState targetState) {
   const degree_t target{params.statePositions[targetState].value()};
   const LadybrownState startingState{state};
+  const second_t start{time()};
   follower->startProfile(getPosition(), target);
   while(!follower->isDone() && state == startingState) {
     const double followerOutput{
@@ -143,6 +144,12 @@ void Ladybrown::moveTo(const LadybrownState targetState) {
     voltage = followerOutput;
     wait();
   }
+  moves.add();
+  if(state != startingState) {
+    interruptedMoves.add();
+  } else {
+    moveTimes.add(getValueAs<second_t>(time() - start));
+  }
   stop();
 }
 
@@ -221,22 +228,37 @@ double Ladybrown::getHoldOutput() {
   return holdOutput;
 }
 
+const Telemetry::Channel Ladybrown::telemetryChannel{
+    Telemetry::addChannel("ladybrown", {"state", "position_deg"})};
+
+Metrics::Counter Ladybrown::moves{"ladybrown moves"};
+
+Metrics::Counter Ladybrown::interruptedMoves{"ladybrown interrupted moves"};
+
+Metrics::Histogram Ladybrown::moveTimes{"ladybrown move s",
+                                        {0.25, 0.5, 0.75, 1, 1.5, 2}};
+
 TASK_DEFINITIONS_FOR(Ladybrown) {
   START_TASK("Ladybrown State Machine")
+  Rate rate{50_ms};
   while(true) {
+    Telemetry::record(telemetryChannel,
+                      static_cast<int>(state),
+                      getValueAs<degree_t>(getPosition()));
     switch(state) {
       case LadybrownState::Idle: voltage = 0; break;
       case LadybrownState::Extending: voltage = params.manualVoltage; break;
       case LadybrownState::Retracting: voltage = -params.manualVoltage; break;
       default: moveTo(state); break;
     }
-    wait(50_ms);
+    rate.wait();
   }
   END_TASK
 
   START_TASK("Ladybrown Control")
+  Rate rate{};
   while(true) {
-    wait(); // At the top because of continue statement below.
+    rate.wait(); // At the top because of continue statement below.
     handlePiston();
     if(maintainMotors()) {
       continue;